@@ -0,0 +1,99 @@
+#include "micro_benchmark_utils.hpp"
+
+#include <algorithm>
+#include <iomanip>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "storage/chunk.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// the table configurations used by register_table_arguments: row count, chunk size, and distribution
+const std::vector<std::vector<int64_t>> TABLE_ARGUMENTS = {
+    {100'000, 10'000, static_cast<int64_t>(ValueDistribution::Uniform)},
+    {1'000'000, 100'000, static_cast<int64_t>(ValueDistribution::Uniform)},
+    {1'000'000, 100'000, static_cast<int64_t>(ValueDistribution::Skewed)}};
+
+}  // namespace
+
+std::shared_ptr<Table> create_benchmark_table(const size_t row_count, const ChunkOffset chunk_size,
+                                              const ValueDistribution distribution, const int distinct_value_count) {
+  Assert(chunk_size > 0, "chunk size must be positive");
+
+  auto weights = std::vector<double>(static_cast<size_t>(distinct_value_count), 1.0);
+  if (distribution == ValueDistribution::Skewed) {
+    for (auto value = size_t{0}; value < weights.size(); ++value) {
+      weights[value] = 1.0 / static_cast<double>(value + 1);
+    }
+  }
+  auto random_engine = std::mt19937{42};
+  auto value_distribution = std::discrete_distribution<int>(weights.cbegin(), weights.cend());
+
+  auto table = std::make_shared<Table>(chunk_size);
+  table->add_column("a", "int");
+  table->add_column("b", "string");
+
+  for (auto first_row = size_t{0}; first_row < row_count; first_row += chunk_size) {
+    const auto size = std::min(static_cast<size_t>(chunk_size), row_count - first_row);
+    auto int_values = ValueVector<int>{};
+    auto string_values = ValueVector<std::string>{};
+    int_values.reserve(size);
+    string_values.reserve(size);
+
+    for (auto row = size_t{0}; row < size; ++row) {
+      const auto value = value_distribution(random_engine);
+      int_values.push_back(value);
+      string_values.push_back(benchmark_string_value(value));
+    }
+
+    auto chunk = Chunk{};
+    chunk.add_segment(std::make_shared<ValueSegment<int>>(std::move(int_values)));
+    chunk.add_segment(std::make_shared<ValueSegment<std::string>>(std::move(string_values)));
+    table->emplace_chunk(std::move(chunk));
+  }
+
+  return table;
+}
+
+void MicroBenchmarkTableFixture::SetUp(benchmark::State& state) {
+  _table = create_benchmark_table(static_cast<size_t>(state.range(0)), static_cast<ChunkOffset>(state.range(1)),
+                                  static_cast<ValueDistribution>(state.range(2)));
+}
+
+void MicroBenchmarkTableFixture::TearDown(benchmark::State& state) { _table = nullptr; }
+
+void register_table_arguments(benchmark::internal::Benchmark* benchmark, const std::string& additional_argument_name,
+                              const std::vector<int64_t>& additional_values) {
+  auto argument_names = std::vector<std::string>{"rows", "chunk_size", "distribution"};
+  if (!additional_values.empty()) argument_names.push_back(additional_argument_name);
+  benchmark->ArgNames(argument_names);
+
+  for (const auto& table_arguments : TABLE_ARGUMENTS) {
+    if (additional_values.empty()) {
+      benchmark->Args(table_arguments);
+      continue;
+    }
+    for (const auto additional_value : additional_values) {
+      auto arguments = table_arguments;
+      arguments.push_back(additional_value);
+      benchmark->Args(arguments);
+    }
+  }
+}
+
+std::string benchmark_string_value(const int value) {
+  auto stream = std::ostringstream{};
+  stream << "value_" << std::setw(6) << std::setfill('0') << value;
+  return stream.str();
+}
+
+}  // namespace opossum
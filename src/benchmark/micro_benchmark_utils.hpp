@@ -0,0 +1,45 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "storage/table.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+enum class ValueDistribution { Uniform, Skewed };
+
+// Creates a table with an int column "a" and a string column "b" and fills it with row_count rows of random values
+// from [0, distinct_value_count). The strings are the zero-padded numbers. With a skewed distribution, the value v is
+// drawn with a probability proportional to 1 / (v + 1). The values are generated with a fixed seed, so every run of
+// a benchmark scans the same table. All chunks are ValueSegments, but they are added as whole chunks, so that the
+// table can be generated much faster than with Table::append.
+std::shared_ptr<Table> create_benchmark_table(size_t row_count, ChunkOffset chunk_size,
+                                              ValueDistribution distribution, int distinct_value_count = 1'000);
+
+// Base fixture for benchmarks that run on a generated table. Its first three arguments are the row count, the chunk
+// size, and the ValueDistribution, e.g., ->Args({1'000'000, 100'000, 0}). The table is created anew for every
+// benchmark run, but not for every iteration.
+class MicroBenchmarkTableFixture : public benchmark::Fixture {
+ public:
+  void SetUp(benchmark::State& state) override;
+  void TearDown(benchmark::State& state) override;
+
+ protected:
+  std::shared_ptr<Table> _table;
+};
+
+// Adds the default combinations of row count, chunk size, and distribution to a benchmark. If additional values are
+// given (e.g., the ScanTypes), each combination is registered once for every value, which becomes the fourth argument.
+void register_table_arguments(benchmark::internal::Benchmark* benchmark,
+                              const std::string& additional_argument_name = {},
+                              const std::vector<int64_t>& additional_values = {});
+
+// formats an int value of a benchmark table as it is stored in the string column
+std::string benchmark_string_value(int value);
+
+}  // namespace opossum
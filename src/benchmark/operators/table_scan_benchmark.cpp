@@ -0,0 +1,71 @@
+#include <memory>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "../micro_benchmark_utils.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+namespace {
+
+// a search value in the middle of the value range, i.e., uniformly distributed values are less than it for every
+// second row, while skewed values are mostly less than it
+constexpr auto SEARCH_VALUE = 500;
+
+void register_scan_arguments(benchmark::internal::Benchmark* benchmark) {
+  auto scan_types = std::vector<int64_t>{};
+  for (auto scan_type : {ScanType::OpEquals, ScanType::OpNotEquals, ScanType::OpLessThan, ScanType::OpLessThanEquals,
+                         ScanType::OpGreaterThan, ScanType::OpGreaterThanEquals}) {
+    scan_types.push_back(static_cast<int64_t>(scan_type));
+  }
+  register_table_arguments(benchmark, "scan_type", scan_types);
+}
+
+// scans the int column of the input with the ScanType given as fourth argument in every iteration
+void scan(benchmark::State& state, const std::shared_ptr<const AbstractOperator>& input) {
+  const auto scan_type = static_cast<ScanType>(state.range(3));
+  const auto input_row_count = input->get_output()->row_count();
+
+  for (auto _ : state) {
+    auto table_scan = std::make_shared<TableScan>(input, ColumnID{0}, scan_type, SEARCH_VALUE);
+    table_scan->execute();
+    benchmark::DoNotOptimize(table_scan->get_output());
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * input_row_count));
+}
+
+}  // namespace
+
+BENCHMARK_DEFINE_F(MicroBenchmarkTableFixture, TableScanValueSegment)(benchmark::State& state) {
+  auto table_wrapper = std::make_shared<TableWrapper>(_table);
+  table_wrapper->execute();
+  scan(state, table_wrapper);
+}
+BENCHMARK_REGISTER_F(MicroBenchmarkTableFixture, TableScanValueSegment)->Apply(register_scan_arguments);
+
+BENCHMARK_DEFINE_F(MicroBenchmarkTableFixture, TableScanDictionarySegment)(benchmark::State& state) {
+  for (ChunkID chunk_id{0}; chunk_id < _table->chunk_count(); ++chunk_id) {
+    _table->compress_chunk(chunk_id);
+  }
+  auto table_wrapper = std::make_shared<TableWrapper>(_table);
+  table_wrapper->execute();
+  scan(state, table_wrapper);
+}
+BENCHMARK_REGISTER_F(MicroBenchmarkTableFixture, TableScanDictionarySegment)->Apply(register_scan_arguments);
+
+// scans the reference segments that a preceding scan on the string column produced
+BENCHMARK_DEFINE_F(MicroBenchmarkTableFixture, TableScanReferenceSegment)(benchmark::State& state) {
+  auto table_wrapper = std::make_shared<TableWrapper>(_table);
+  table_wrapper->execute();
+  auto input_scan = std::make_shared<TableScan>(table_wrapper, ColumnID{1}, ScanType::OpLessThan,
+                                                benchmark_string_value(SEARCH_VALUE));
+  input_scan->execute();
+  scan(state, input_scan);
+}
+BENCHMARK_REGISTER_F(MicroBenchmarkTableFixture, TableScanReferenceSegment)->Apply(register_scan_arguments);
+
+}  // namespace opossum
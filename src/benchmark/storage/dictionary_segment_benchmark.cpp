@@ -0,0 +1,43 @@
+#include <memory>
+#include <string>
+
+#include "benchmark/benchmark.h"
+
+#include "../micro_benchmark_utils.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+namespace {
+
+// encodes the segments of one column of all chunks in every iteration, without modifying the table
+template <typename T>
+void construct_dictionary_segments(benchmark::State& state, const Table& table, const ColumnID column_id) {
+  for (auto _ : state) {
+    for (ChunkID chunk_id{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+      const auto segment = table.get_chunk(chunk_id).get_segment(column_id);
+      auto dictionary_segment = std::make_shared<DictionarySegment<T>>(segment);
+      benchmark::DoNotOptimize(dictionary_segment);
+    }
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * table.row_count()));
+}
+
+}  // namespace
+
+BENCHMARK_DEFINE_F(MicroBenchmarkTableFixture, DictionarySegmentConstructionInt)(benchmark::State& state) {
+  construct_dictionary_segments<int>(state, *_table, ColumnID{0});
+}
+BENCHMARK_REGISTER_F(MicroBenchmarkTableFixture, DictionarySegmentConstructionInt)->Apply([](auto benchmark) {
+  register_table_arguments(benchmark);
+});
+
+BENCHMARK_DEFINE_F(MicroBenchmarkTableFixture, DictionarySegmentConstructionString)(benchmark::State& state) {
+  construct_dictionary_segments<std::string>(state, *_table, ColumnID{1});
+}
+BENCHMARK_REGISTER_F(MicroBenchmarkTableFixture, DictionarySegmentConstructionString)->Apply([](auto benchmark) {
+  register_table_arguments(benchmark);
+});
+
+}  // namespace opossum
@@ -0,0 +1,76 @@
+#include <memory>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "../micro_benchmark_utils.hpp"
+#include "all_type_variant.hpp"
+#include "storage/table.hpp"
+#include "utils/performance_warning.hpp"
+
+namespace opossum {
+
+namespace {
+
+// copies the rows of a benchmark table out of its segments before the benchmark starts, so the slow access through
+// BaseSegment::operator[] is acceptable here
+std::vector<std::vector<AllTypeVariant>> materialize_rows(const Table& table) {
+  PerformanceWarningDisabler performance_warning_disabler;
+  auto rows = std::vector<std::vector<AllTypeVariant>>{};
+  rows.reserve(table.row_count());
+  for (ChunkID chunk_id{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+    const auto& chunk = table.get_chunk(chunk_id);
+    const auto& int_segment = *chunk.get_segment(ColumnID{0});
+    const auto& string_segment = *chunk.get_segment(ColumnID{1});
+    for (ChunkOffset chunk_offset{0}; chunk_offset < chunk.size(); ++chunk_offset) {
+      rows.push_back({int_segment[chunk_offset], string_segment[chunk_offset]});
+    }
+  }
+  return rows;
+}
+
+}  // namespace
+
+// Compresses all chunks of a freshly generated table in every iteration. The fourth argument is the DictionaryScope.
+BENCHMARK_DEFINE_F(MicroBenchmarkTableFixture, TableCompressChunk)(benchmark::State& state) {
+  const auto dictionary_scope = static_cast<DictionaryScope>(state.range(3));
+
+  for (auto _ : state) {
+    state.PauseTiming();
+    SetUp(state);
+    state.ResumeTiming();
+
+    for (ChunkID chunk_id{0}; chunk_id < _table->chunk_count(); ++chunk_id) {
+      _table->compress_chunk(chunk_id, dictionary_scope);
+    }
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * _table->row_count()));
+}
+BENCHMARK_REGISTER_F(MicroBenchmarkTableFixture, TableCompressChunk)->Apply([](auto benchmark) {
+  const auto chunk_scope = static_cast<int64_t>(DictionaryScope::Chunk);
+  const auto column_scope = static_cast<int64_t>(DictionaryScope::Column);
+  register_table_arguments(benchmark, "dictionary_scope", {chunk_scope, column_scope});
+});
+
+// Inserts the rows of the generated table one by one into an empty table with the same chunk size.
+BENCHMARK_DEFINE_F(MicroBenchmarkTableFixture, TableAppend)(benchmark::State& state) {
+  const auto rows = materialize_rows(*_table);
+
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto table = Table{_table->chunk_size()};
+    table.add_column("a", "int");
+    table.add_column("b", "string");
+    state.ResumeTiming();
+
+    for (const auto& row : rows) {
+      table.append(row);
+    }
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * rows.size()));
+}
+BENCHMARK_REGISTER_F(MicroBenchmarkTableFixture, TableAppend)->Apply([](auto benchmark) {
+  register_table_arguments(benchmark);
+});
+
+}  // namespace opossum
@@ -0,0 +1,235 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <numeric>
+#include <set>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "operators/abstract_operator.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "tpch_queries.hpp"
+#include "tpch_table_generator.hpp"
+#include "utils/assert.hpp"
+#include "utils/hardware_counters.hpp"
+#include "utils/performance_warning.hpp"
+#include "utils/tracing.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+constexpr auto USAGE = R"(Usage: hyriseBenchmarkTPCH [options]
+Generates the TPC-H tables and executes the predicates of the TPC-H queries repeatedly.
+The results are written as JSON to stdout or to the given output file.
+
+  --scale_factor <float>  scale factor of the generated data (default: 0.1)
+  --chunk_size <int>      maximum number of rows per chunk (default: 100000)
+  --compress              dictionary-compress all chunks
+  --pipelined             fuse the scans on each table into a Pipeline
+  --hardware_counters     measure cycles, instructions, LLC and branch misses of the operators, if the system permits
+  --runs <int>            number of measured runs per query (default: 10)
+  --warmup_runs <int>     number of runs per query before the measurement (default: 1)
+  --queries <list>        comma-separated names of the queries to run, e.g., Q1,Q6 (default: all)
+  --output <file>         file to write the results to
+  --trace <file>          file to write a timeline of the measured runs to, viewable in Perfetto or about:tracing
+)";
+
+struct BenchmarkConfig {
+  float scale_factor = 0.1f;
+  ChunkOffset chunk_size = 100'000;
+  bool compress = false;
+  bool pipelined = false;
+  bool hardware_counters = false;
+  size_t runs = 10;
+  size_t warmup_runs = 1;
+  std::set<std::string> query_names;
+  std::string output_file_name;
+  std::string trace_file_name;
+};
+
+BenchmarkConfig parse_arguments(const int argc, char* argv[]) {
+  auto config = BenchmarkConfig{};
+  for (auto index = 1; index < argc; ++index) {
+    const auto argument = std::string{argv[index]};
+    const auto next_value = [&]() {
+      Assert(index + 1 < argc, "missing value for " + argument);
+      return std::string{argv[++index]};
+    };
+
+    if (argument == "--scale_factor") {
+      config.scale_factor = std::stof(next_value());
+    } else if (argument == "--chunk_size") {
+      config.chunk_size = static_cast<ChunkOffset>(std::stoul(next_value()));
+    } else if (argument == "--compress") {
+      config.compress = true;
+    } else if (argument == "--pipelined") {
+      config.pipelined = true;
+    } else if (argument == "--hardware_counters") {
+      config.hardware_counters = true;
+    } else if (argument == "--runs") {
+      config.runs = std::stoul(next_value());
+    } else if (argument == "--warmup_runs") {
+      config.warmup_runs = std::stoul(next_value());
+    } else if (argument == "--queries") {
+      auto stream = std::istringstream{next_value()};
+      for (auto name = std::string{}; std::getline(stream, name, ',');) {
+        config.query_names.insert(name);
+      }
+    } else if (argument == "--output") {
+      config.output_file_name = next_value();
+    } else if (argument == "--trace") {
+      config.trace_file_name = next_value();
+    } else {
+      std::cerr << USAGE;
+      std::exit(argument == "--help" ? 0 : 1);
+    }
+  }
+  Assert(config.runs > 0, "at least one run is needed");
+  return config;
+}
+
+struct QueryResult {
+  std::string name;
+  std::vector<std::chrono::nanoseconds> durations;
+  uint64_t result_row_count = 0;
+  // sum of the hardware counters of all operators over all measured runs
+  HardwareCounterValues hardware_counters;
+};
+
+// executes the plan and returns the number of rows of its results, i.e., of the outputs that no operator consumes
+uint64_t execute_plan(const std::vector<std::shared_ptr<AbstractOperator>>& plan) {
+  auto consumed_operators = std::set<std::shared_ptr<const AbstractOperator>>{};
+  for (const auto& op : plan) {
+    op->execute();
+    consumed_operators.insert(op->input_left());
+    consumed_operators.insert(op->input_right());
+  }
+
+  auto row_count = uint64_t{0};
+  for (const auto& op : plan) {
+    if (!consumed_operators.count(op)) row_count += op->get_output()->row_count();
+  }
+  return row_count;
+}
+
+QueryResult run_query(const TpchQuery& query, const BenchmarkConfig& config) {
+  for (auto run = size_t{0}; run < config.warmup_runs; ++run) {
+    execute_plan(create_tpch_plan(query, config.pipelined));
+  }
+
+  auto result = QueryResult{query.name, {}, 0, {}};
+  Tracer::set_enabled(!config.trace_file_name.empty());
+  for (auto run = size_t{0}; run < config.runs; ++run) {
+    const auto begin = std::chrono::steady_clock::now();
+    const auto plan = create_tpch_plan(query, config.pipelined);
+    result.result_row_count = execute_plan(plan);
+    result.durations.push_back(std::chrono::steady_clock::now() - begin);
+    TRACE_INSTANT("benchmark", query.name + " run " + std::to_string(run) + " finished");
+
+    for (const auto& op : plan) {
+      result.hardware_counters += op->performance_data().hardware_counters;
+    }
+  }
+  Tracer::set_enabled(false);
+  return result;
+}
+
+// nearest-rank percentile of sorted durations, in milliseconds
+double percentile(const std::vector<std::chrono::nanoseconds>& sorted_durations, const double percent) {
+  const auto rank = static_cast<size_t>(std::ceil(percent / 100.0 * static_cast<double>(sorted_durations.size())));
+  const auto index = std::max(rank, size_t{1}) - 1;
+  return std::chrono::duration<double, std::milli>{sorted_durations[index]}.count();
+}
+
+void write_json(std::ostream& out, const BenchmarkConfig& config, const std::chrono::nanoseconds generation_duration,
+                const std::vector<QueryResult>& results) {
+  const auto to_milliseconds = [](const auto duration) {
+    return std::chrono::duration<double, std::milli>{duration}.count();
+  };
+
+  out << "{\n  \"context\": {\n";
+  out << "    \"scale_factor\": " << config.scale_factor << ",\n";
+  out << "    \"chunk_size\": " << config.chunk_size << ",\n";
+  out << "    \"compress\": " << (config.compress ? "true" : "false") << ",\n";
+  out << "    \"pipelined\": " << (config.pipelined ? "true" : "false") << ",\n";
+  out << "    \"hardware_counters\": " << (config.hardware_counters ? "true" : "false") << ",\n";
+  out << "    \"runs\": " << config.runs << ",\n";
+  out << "    \"warmup_runs\": " << config.warmup_runs << ",\n";
+  out << "    \"data_generation_ms\": " << to_milliseconds(generation_duration) << "\n";
+  out << "  },\n  \"benchmarks\": [";
+
+  for (auto result_index = size_t{0}; result_index < results.size(); ++result_index) {
+    const auto& result = results[result_index];
+    auto sorted_durations = result.durations;
+    std::sort(sorted_durations.begin(), sorted_durations.end());
+    const auto total_duration =
+        std::accumulate(sorted_durations.cbegin(), sorted_durations.cend(), std::chrono::nanoseconds{0});
+    const auto total_seconds = std::chrono::duration<double>{total_duration}.count();
+
+    out << (result_index == 0 ? "\n" : ",\n") << "    {\n";
+    out << "      \"name\": \"" << result.name << "\",\n";
+    out << "      \"result_row_count\": " << result.result_row_count << ",\n";
+    out << "      \"min_ms\": " << to_milliseconds(sorted_durations.front()) << ",\n";
+    out << "      \"mean_ms\": " << to_milliseconds(total_duration) / static_cast<double>(sorted_durations.size())
+        << ",\n";
+    out << "      \"p50_ms\": " << percentile(sorted_durations, 50.0) << ",\n";
+    out << "      \"p90_ms\": " << percentile(sorted_durations, 90.0) << ",\n";
+    out << "      \"p99_ms\": " << percentile(sorted_durations, 99.0) << ",\n";
+    out << "      \"max_ms\": " << to_milliseconds(sorted_durations.back()) << ",\n";
+    out << "      \"queries_per_second\": " << static_cast<double>(sorted_durations.size()) / total_seconds;
+    if (config.hardware_counters) {
+      // the counters are null if the system does not permit to read them
+      const auto& counters = result.hardware_counters;
+      const auto mean = [&](const uint64_t value) {
+        return counters.available ? std::to_string(value / sorted_durations.size()) : std::string{"null"};
+      };
+      out << ",\n      \"mean_cycles\": " << mean(counters.cycles) << ",\n";
+      out << "      \"mean_instructions\": " << mean(counters.instructions) << ",\n";
+      out << "      \"mean_llc_misses\": " << mean(counters.llc_misses) << ",\n";
+      out << "      \"mean_branch_misses\": " << mean(counters.branch_misses);
+    }
+    out << "\n";
+    out << "    }";
+  }
+  // the slow fallback paths that the queries used
+  out << "\n  ],\n  \"performance_warnings\": ";
+  PerformanceWarningRegistry::write_json(out);
+  out << "}\n";
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  const auto config = parse_arguments(argc, argv);
+  HardwareCounters::set_enabled(config.hardware_counters);
+
+  std::cerr << "Generating TPC-H tables with scale factor " << config.scale_factor << "..." << std::endl;
+  const auto generation_begin = std::chrono::steady_clock::now();
+  TpchTableGenerator{config.scale_factor, config.chunk_size, config.compress}.generate_and_store();
+  const auto generation_duration = std::chrono::steady_clock::now() - generation_begin;
+  PerformanceWarningRegistry::reset();
+
+  auto results = std::vector<QueryResult>{};
+  for (const auto& query : tpch_queries()) {
+    if (!config.query_names.empty() && !config.query_names.count(query.name)) continue;
+    std::cerr << "Running " << query.name << "..." << std::endl;
+    results.push_back(run_query(query, config));
+  }
+  Assert(!results.empty(), "no query matches the given names");
+  if (!config.trace_file_name.empty()) Tracer::write_chrome_trace(config.trace_file_name);
+
+  if (config.output_file_name.empty()) {
+    write_json(std::cout, config, generation_duration, results);
+  } else {
+    auto output_file = std::ofstream{config.output_file_name};
+    Assert(output_file.is_open(), "could not open " + config.output_file_name);
+    write_json(output_file, config, generation_duration, results);
+  }
+  return 0;
+}
@@ -0,0 +1,68 @@
+#include "tpch_queries.hpp"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "operators/get_table.hpp"
+#include "operators/pipeline.hpp"
+#include "operators/table_scan.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+const std::vector<TpchQuery>& tpch_queries() {
+  static const auto queries = std::vector<TpchQuery>{
+      {"Q1", {{"lineitem", {{"l_shipdate", ScanType::OpLessThanEquals, "1998-09-02"}}}}},
+      {"Q3",
+       {{"customer", {{"c_mktsegment", ScanType::OpEquals, "BUILDING"}}},
+        {"orders", {{"o_orderdate", ScanType::OpLessThan, "1995-03-15"}}},
+        {"lineitem", {{"l_shipdate", ScanType::OpGreaterThan, "1995-03-15"}}}}},
+      {"Q6",
+       {{"lineitem",
+         {{"l_shipdate", ScanType::OpGreaterThanEquals, "1994-01-01"},
+          {"l_shipdate", ScanType::OpLessThan, "1995-01-01"},
+          {"l_discount", ScanType::OpGreaterThanEquals, 0.05f},
+          {"l_discount", ScanType::OpLessThanEquals, 0.07f},
+          {"l_quantity", ScanType::OpLessThan, 24.0f}}}}},
+      {"Q10",
+       {{"orders",
+         {{"o_orderdate", ScanType::OpGreaterThanEquals, "1993-10-01"},
+          {"o_orderdate", ScanType::OpLessThan, "1994-01-01"}}},
+        {"lineitem", {{"l_returnflag", ScanType::OpEquals, "R"}}}}},
+      {"Q14",
+       {{"lineitem",
+         {{"l_shipdate", ScanType::OpGreaterThanEquals, "1995-09-01"},
+          {"l_shipdate", ScanType::OpLessThan, "1995-10-01"}}}}},
+      {"Q19",
+       {{"part",
+         {{"p_brand", ScanType::OpEquals, "Brand#12"},
+          {"p_size", ScanType::OpGreaterThanEquals, 1},
+          {"p_size", ScanType::OpLessThanEquals, 5}}},
+        {"lineitem",
+         {{"l_shipinstruct", ScanType::OpEquals, "DELIVER IN PERSON"},
+          {"l_quantity", ScanType::OpGreaterThanEquals, 1.0f},
+          {"l_quantity", ScanType::OpLessThanEquals, 11.0f}}}}}};
+  return queries;
+}
+
+std::vector<std::shared_ptr<AbstractOperator>> create_tpch_plan(const TpchQuery& query, const bool pipelined) {
+  auto plan = std::vector<std::shared_ptr<AbstractOperator>>{};
+  for (const auto& filter : query.filters) {
+    const auto table = StorageManager::get().get_table(filter.table_name);
+    const auto get_table = std::make_shared<GetTable>(filter.table_name);
+    plan.push_back(get_table);
+
+    auto input = std::shared_ptr<AbstractOperator>{get_table};
+    for (const auto& predicate : filter.predicates) {
+      input = std::make_shared<TableScan>(input, table->column_id_by_name(predicate.column_name), predicate.scan_type,
+                                          predicate.value);
+      if (!pipelined) plan.push_back(input);
+    }
+    if (pipelined) plan.push_back(Pipeline::create(input));
+  }
+  return plan;
+}
+
+}  // namespace opossum
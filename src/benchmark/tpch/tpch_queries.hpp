@@ -0,0 +1,38 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "operators/abstract_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+struct TpchPredicate {
+  std::string column_name;
+  ScanType scan_type;
+  AllTypeVariant value;
+};
+
+// a conjunction of predicates on one table, evaluated by a chain of TableScans in the given order
+struct TpchTableFilter {
+  std::string table_name;
+  std::vector<TpchPredicate> predicates;
+};
+
+// Our operators do not include joins and aggregates yet, so the plans of the TPC-H queries only evaluate their
+// predicates on the base tables, with the substitution parameters of the validation run of the specification.
+struct TpchQuery {
+  std::string name;
+  std::vector<TpchTableFilter> filters;
+};
+
+const std::vector<TpchQuery>& tpch_queries();
+
+// Creates the operators of a query plan in the order in which they have to be executed. The tables are retrieved from
+// the StorageManager. If pipelined is set, the scans on each table are fused into a Pipeline.
+std::vector<std::shared_ptr<AbstractOperator>> create_tpch_plan(const TpchQuery& query, bool pipelined);
+
+}  // namespace opossum
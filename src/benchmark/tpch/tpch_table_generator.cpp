@@ -0,0 +1,403 @@
+#include "tpch_table_generator.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <map>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "storage/chunk.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/value_segment.hpp"
+#include "storage/value_vector.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Collects the rows of a table in typed value vectors and adds them to the table as a chunk whenever the chunk size is
+// reached. This is much faster than Table::append, which converts every value from an AllTypeVariant.
+template <typename... DataTypes>
+class TableBuilder {
+ public:
+  // column_definitions contains the name and the type (e.g., "int") of every column
+  TableBuilder(const ChunkOffset chunk_size, const bool compress,
+               const std::vector<std::pair<std::string, std::string>>& column_definitions)
+      : _table(std::make_shared<Table>(chunk_size)), _compress(compress) {
+    Assert(column_definitions.size() == sizeof...(DataTypes), "one column definition per data type expected");
+    for (const auto& [name, type] : column_definitions) {
+      _table->add_column(name, type);
+    }
+  }
+
+  void append_row(const DataTypes&... values) {
+    _append_row(std::index_sequence_for<DataTypes...>{}, values...);
+    if (std::get<0>(_values).size() == _table->chunk_size()) _emplace_chunk();
+  }
+
+  std::shared_ptr<Table> finish() {
+    if (!std::get<0>(_values).empty()) _emplace_chunk();
+    return _table;
+  }
+
+ protected:
+  template <size_t... Indices>
+  void _append_row(std::index_sequence<Indices...>, const DataTypes&... values) {
+    (std::get<Indices>(_values).push_back(values), ...);
+  }
+
+  template <size_t... Indices>
+  void _add_segments(std::index_sequence<Indices...>, Chunk& chunk) {
+    (chunk.add_segment(std::make_shared<ValueSegment<DataTypes>>(std::move(std::get<Indices>(_values)))), ...);
+    _values = std::tuple<ValueVector<DataTypes>...>{};
+  }
+
+  void _emplace_chunk() {
+    auto chunk = Chunk{};
+    _add_segments(std::index_sequence_for<DataTypes...>{}, chunk);
+    _table->emplace_chunk(std::move(chunk));
+    if (_compress) _table->compress_chunk(ChunkID{_table->chunk_count() - 1});
+  }
+
+  std::shared_ptr<Table> _table;
+  const bool _compress;
+  std::tuple<ValueVector<DataTypes>...> _values;
+};
+
+// the dates of the benchmark are the days from STARTDATE (1992-01-01) to ENDDATE (1998-12-31)
+std::vector<std::string> generate_dates() {
+  auto dates = std::vector<std::string>{};
+  for (auto year = 1992; year <= 1998; ++year) {
+    const auto is_leap_year = year % 4 == 0;
+    const int days_per_month[] = {31, is_leap_year ? 29 : 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+    for (auto month = 1; month <= 12; ++month) {
+      for (auto day = 1; day <= days_per_month[month - 1]; ++day) {
+        char date[32];
+        std::snprintf(date, sizeof(date), "%04d-%02d-%02d", year, month, day);
+        dates.emplace_back(date);
+      }
+    }
+  }
+  return dates;
+}
+
+const auto DATES = generate_dates();
+// the dates are given as indices into DATES
+const auto CURRENT_DATE = 1263;  // 1995-06-17
+const auto LAST_ORDER_DATE = static_cast<int>(DATES.size()) - 1 - 151;
+
+// formats a key with a prefix and zero padding, e.g., Supplier#000000001
+std::string format_key(const std::string& prefix, const int key, const int width = 9) {
+  char digits[32];
+  std::snprintf(digits, sizeof(digits), "%0*d", width, key);
+  return prefix + digits;
+}
+
+const std::vector<std::string> REGIONS = {"AFRICA", "AMERICA", "ASIA", "EUROPE", "MIDDLE EAST"};
+
+const std::vector<std::pair<std::string, int>> NATIONS = {
+    {"ALGERIA", 0},       {"ARGENTINA", 1},  {"BRAZIL", 1},  {"CANADA", 1},     {"EGYPT", 4},
+    {"ETHIOPIA", 0},      {"FRANCE", 3},     {"GERMANY", 3}, {"INDIA", 2},      {"INDONESIA", 2},
+    {"IRAN", 4},          {"IRAQ", 4},       {"JAPAN", 2},   {"JORDAN", 4},     {"KENYA", 0},
+    {"MOROCCO", 0},       {"MOZAMBIQUE", 0}, {"PERU", 1},    {"CHINA", 2},      {"ROMANIA", 3},
+    {"SAUDI ARABIA", 4},  {"VIETNAM", 2},    {"RUSSIA", 3},  {"UNITED KINGDOM", 3}, {"UNITED STATES", 1}};
+
+const std::vector<std::string> SEGMENTS = {"AUTOMOBILE", "BUILDING", "FURNITURE", "MACHINERY", "HOUSEHOLD"};
+const std::vector<std::string> PRIORITIES = {"1-URGENT", "2-HIGH", "3-MEDIUM", "4-NOT SPECIFIED", "5-LOW"};
+const std::vector<std::string> INSTRUCTIONS = {"DELIVER IN PERSON", "COLLECT COD", "NONE", "TAKE BACK RETURN"};
+const std::vector<std::string> MODES = {"REG AIR", "AIR", "RAIL", "SHIP", "TRUCK", "MAIL", "FOB"};
+const std::vector<std::string> TYPE_SYLLABLES_1 = {"STANDARD", "SMALL", "MEDIUM", "LARGE", "ECONOMY", "PROMO"};
+const std::vector<std::string> TYPE_SYLLABLES_2 = {"ANODIZED", "BURNISHED", "PLATED", "POLISHED", "BRUSHED"};
+const std::vector<std::string> TYPE_SYLLABLES_3 = {"TIN", "NICKEL", "BRASS", "STEEL", "COPPER"};
+const std::vector<std::string> CONTAINER_SYLLABLES_1 = {"SM", "LG", "MED", "JUMBO", "WRAP"};
+const std::vector<std::string> CONTAINER_SYLLABLES_2 = {"CASE", "BOX", "BAG", "JAR", "PKG", "PACK", "CAN", "DRUM"};
+const std::vector<std::string> COLORS = {
+    "almond", "antique", "aquamarine", "azure",  "beige",     "bisque", "black",     "blanched", "blue",
+    "blush",  "brown",   "burlywood",  "chiffon", "chocolate", "coral",  "cornflower", "cream",    "cyan",
+    "dark",   "deep",    "dim",        "dodger",  "drab",      "firebrick", "floral", "forest",   "frosted",
+    "gainsboro", "ghost", "goldenrod", "green",   "grey",      "honeydew", "hot",     "indian",   "ivory",
+    "khaki",  "lace",    "lavender",   "lawn",    "lemon",     "light",  "lime",      "linen",    "magenta",
+    "maroon", "medium",  "metallic",   "midnight", "mint",     "misty",  "moccasin",  "navajo",   "navy"};
+const std::vector<std::string> WORDS = {
+    "furiously", "sly",      "careful",  "blithely", "quickly",  "fluffily", "slyly",   "carefully", "ironic",
+    "final",     "regular",  "express",  "special",  "pending",  "bold",     "even",    "silent",    "unusual",
+    "packages",  "requests", "accounts", "deposits", "foxes",    "ideas",    "theodolites", "pinto", "beans",
+    "instructions", "dependencies", "excuses", "platelets", "asymptotes", "courts", "dolphins", "sleep", "wake",
+    "are",       "haggle",   "nag",      "use",      "boost",    "affix",    "detect",  "integrate", "cajole"};
+
+}  // namespace
+
+TpchTableGenerator::TpchTableGenerator(const float scale_factor, const ChunkOffset chunk_size, const bool compress)
+    : _scale_factor(scale_factor), _chunk_size(chunk_size), _compress(compress), _random_engine(42) {
+  Assert(scale_factor > 0.0f, "scale factor must be positive");
+}
+
+std::map<std::string, std::shared_ptr<Table>> TpchTableGenerator::generate_all_tables() {
+  auto tables = std::map<std::string, std::shared_ptr<Table>>{};
+  tables["region"] = _generate_region();
+  tables["nation"] = _generate_nation();
+  tables["supplier"] = _generate_supplier();
+  tables["customer"] = _generate_customer();
+  tables["part"] = _generate_part();
+  tables["partsupp"] = _generate_partsupp();
+  std::tie(tables["orders"], tables["lineitem"]) = _generate_orders_and_lineitem();
+  return tables;
+}
+
+void TpchTableGenerator::generate_and_store() {
+  for (auto& [name, table] : generate_all_tables()) {
+    StorageManager::get().add_table(name, table);
+  }
+}
+
+int TpchTableGenerator::_random_int(const int min, const int max) {
+  return std::uniform_int_distribution<int>{min, max}(_random_engine);
+}
+
+float TpchTableGenerator::_random_decimal(const int min_cents, const int max_cents) {
+  return static_cast<float>(_random_int(min_cents, max_cents)) / 100.0f;
+}
+
+std::string TpchTableGenerator::_random_text(const size_t min_length, const size_t max_length) {
+  const auto length = static_cast<size_t>(_random_int(static_cast<int>(min_length), static_cast<int>(max_length)));
+  auto text = std::string{};
+  while (text.size() < length) {
+    if (!text.empty()) text += ' ';
+    text += _random_element(WORDS);
+  }
+  text.resize(length);
+  return text;
+}
+
+std::string TpchTableGenerator::_random_phone(const int nation_key) {
+  char phone[64];
+  std::snprintf(phone, sizeof(phone), "%02d-%03d-%03d-%04d", nation_key + 10, _random_int(100, 999),
+                _random_int(100, 999), _random_int(1000, 9999));
+  return phone;
+}
+
+const std::string& TpchTableGenerator::_random_element(const std::vector<std::string>& elements) {
+  return elements[static_cast<size_t>(_random_int(0, static_cast<int>(elements.size()) - 1))];
+}
+
+size_t TpchTableGenerator::_scaled(const size_t base_row_count) const {
+  return std::max(size_t{1}, static_cast<size_t>(static_cast<double>(base_row_count) * _scale_factor));
+}
+
+std::shared_ptr<Table> TpchTableGenerator::_generate_region() {
+  auto builder = TableBuilder<int, std::string, std::string>{
+      _chunk_size, _compress, {{"r_regionkey", "int"}, {"r_name", "string"}, {"r_comment", "string"}}};
+  for (auto region_key = 0; region_key < static_cast<int>(REGIONS.size()); ++region_key) {
+    builder.append_row(region_key, REGIONS[region_key], _random_text(31, 115));
+  }
+  return builder.finish();
+}
+
+std::shared_ptr<Table> TpchTableGenerator::_generate_nation() {
+  auto builder = TableBuilder<int, std::string, int, std::string>{
+      _chunk_size,
+      _compress,
+      {{"n_nationkey", "int"}, {"n_name", "string"}, {"n_regionkey", "int"}, {"n_comment", "string"}}};
+  for (auto nation_key = 0; nation_key < static_cast<int>(NATIONS.size()); ++nation_key) {
+    const auto& [name, region_key] = NATIONS[nation_key];
+    builder.append_row(nation_key, name, region_key, _random_text(31, 114));
+  }
+  return builder.finish();
+}
+
+std::shared_ptr<Table> TpchTableGenerator::_generate_supplier() {
+  auto builder = TableBuilder<int, std::string, std::string, int, std::string, float, std::string>{
+      _chunk_size,
+      _compress,
+      {{"s_suppkey", "int"},
+       {"s_name", "string"},
+       {"s_address", "string"},
+       {"s_nationkey", "int"},
+       {"s_phone", "string"},
+       {"s_acctbal", "float"},
+       {"s_comment", "string"}}};
+  const auto supplier_count = static_cast<int>(_scaled(10'000));
+  for (auto supplier_key = 1; supplier_key <= supplier_count; ++supplier_key) {
+    const auto nation_key = _random_int(0, static_cast<int>(NATIONS.size()) - 1);
+    builder.append_row(supplier_key, format_key("Supplier#", supplier_key), _random_text(10, 40), nation_key,
+                       _random_phone(nation_key), _random_decimal(-99'999, 999'999), _random_text(25, 100));
+  }
+  return builder.finish();
+}
+
+std::shared_ptr<Table> TpchTableGenerator::_generate_customer() {
+  auto builder = TableBuilder<int, std::string, std::string, int, std::string, float, std::string, std::string>{
+      _chunk_size,
+      _compress,
+      {{"c_custkey", "int"},
+       {"c_name", "string"},
+       {"c_address", "string"},
+       {"c_nationkey", "int"},
+       {"c_phone", "string"},
+       {"c_acctbal", "float"},
+       {"c_mktsegment", "string"},
+       {"c_comment", "string"}}};
+  const auto customer_count = static_cast<int>(_scaled(150'000));
+  for (auto customer_key = 1; customer_key <= customer_count; ++customer_key) {
+    const auto nation_key = _random_int(0, static_cast<int>(NATIONS.size()) - 1);
+    builder.append_row(customer_key, format_key("Customer#", customer_key), _random_text(10, 40), nation_key,
+                       _random_phone(nation_key), _random_decimal(-99'999, 999'999), _random_element(SEGMENTS),
+                       _random_text(29, 116));
+  }
+  return builder.finish();
+}
+
+namespace {
+
+// the retail price of a part is a function of its key (see the TPC-H specification)
+float retail_price(const int part_key) {
+  return static_cast<float>(90'000 + ((part_key / 10) % 20'001) + 100 * (part_key % 1'000)) / 100.0f;
+}
+
+// the i-th of the four suppliers of a part (0 <= i < 4), given the number of suppliers
+int supplier_of_part(const int part_key, const int i, const int supplier_count) {
+  const auto offset = static_cast<int64_t>(i) * (supplier_count / 4 + (part_key - 1) / supplier_count);
+  return static_cast<int>((part_key + offset) % supplier_count) + 1;
+}
+
+}  // namespace
+
+std::shared_ptr<Table> TpchTableGenerator::_generate_part() {
+  auto builder =
+      TableBuilder<int, std::string, std::string, std::string, std::string, int, std::string, float, std::string>{
+          _chunk_size,
+          _compress,
+          {{"p_partkey", "int"},
+           {"p_name", "string"},
+           {"p_mfgr", "string"},
+           {"p_brand", "string"},
+           {"p_type", "string"},
+           {"p_size", "int"},
+           {"p_container", "string"},
+           {"p_retailprice", "float"},
+           {"p_comment", "string"}}};
+  const auto part_count = static_cast<int>(_scaled(200'000));
+  for (auto part_key = 1; part_key <= part_count; ++part_key) {
+    auto name = _random_element(COLORS);
+    for (auto word = 1; word < 5; ++word) {
+      name += ' ' + _random_element(COLORS);
+    }
+    const auto manufacturer = _random_int(1, 5);
+    const auto brand = manufacturer * 10 + _random_int(1, 5);
+    const auto type = _random_element(TYPE_SYLLABLES_1) + ' ' + _random_element(TYPE_SYLLABLES_2) + ' ' +
+                      _random_element(TYPE_SYLLABLES_3);
+    const auto container = _random_element(CONTAINER_SYLLABLES_1) + ' ' + _random_element(CONTAINER_SYLLABLES_2);
+    builder.append_row(part_key, name, "Manufacturer#" + std::to_string(manufacturer),
+                       "Brand#" + std::to_string(brand), type, _random_int(1, 50), container, retail_price(part_key),
+                       _random_text(5, 22));
+  }
+  return builder.finish();
+}
+
+std::shared_ptr<Table> TpchTableGenerator::_generate_partsupp() {
+  auto builder = TableBuilder<int, int, int, float, std::string>{_chunk_size,
+                                                                 _compress,
+                                                                 {{"ps_partkey", "int"},
+                                                                  {"ps_suppkey", "int"},
+                                                                  {"ps_availqty", "int"},
+                                                                  {"ps_supplycost", "float"},
+                                                                  {"ps_comment", "string"}}};
+  const auto part_count = static_cast<int>(_scaled(200'000));
+  const auto supplier_count = static_cast<int>(_scaled(10'000));
+  for (auto part_key = 1; part_key <= part_count; ++part_key) {
+    for (auto i = 0; i < 4; ++i) {
+      builder.append_row(part_key, supplier_of_part(part_key, i, supplier_count), _random_int(1, 9'999),
+                         _random_decimal(100, 100'000), _random_text(49, 198));
+    }
+  }
+  return builder.finish();
+}
+
+std::pair<std::shared_ptr<Table>, std::shared_ptr<Table>> TpchTableGenerator::_generate_orders_and_lineitem() {
+  auto orders_builder =
+      TableBuilder<int, int, std::string, float, std::string, std::string, std::string, int, std::string>{
+          _chunk_size,
+          _compress,
+          {{"o_orderkey", "int"},
+           {"o_custkey", "int"},
+           {"o_orderstatus", "string"},
+           {"o_totalprice", "float"},
+           {"o_orderdate", "string"},
+           {"o_orderpriority", "string"},
+           {"o_clerk", "string"},
+           {"o_shippriority", "int"},
+           {"o_comment", "string"}}};
+  auto lineitem_builder = TableBuilder<int, int, int, int, float, float, float, float, std::string, std::string,
+                                       std::string, std::string, std::string, std::string, std::string, std::string>{
+      _chunk_size,
+      _compress,
+      {{"l_orderkey", "int"},
+       {"l_partkey", "int"},
+       {"l_suppkey", "int"},
+       {"l_linenumber", "int"},
+       {"l_quantity", "float"},
+       {"l_extendedprice", "float"},
+       {"l_discount", "float"},
+       {"l_tax", "float"},
+       {"l_returnflag", "string"},
+       {"l_linestatus", "string"},
+       {"l_shipdate", "string"},
+       {"l_commitdate", "string"},
+       {"l_receiptdate", "string"},
+       {"l_shipinstruct", "string"},
+       {"l_shipmode", "string"},
+       {"l_comment", "string"}}};
+
+  const auto order_count = static_cast<int>(_scaled(1'500'000));
+  const auto customer_count = static_cast<int>(_scaled(150'000));
+  const auto part_count = static_cast<int>(_scaled(200'000));
+  const auto supplier_count = static_cast<int>(_scaled(10'000));
+  const auto clerk_count = static_cast<int>(_scaled(1'000));
+
+  for (auto order_index = 0; order_index < order_count; ++order_index) {
+    // only the first eight of every 32 keys are used
+    const auto order_key = (order_index / 8) * 32 + order_index % 8 + 1;
+    // every third customer does not place orders
+    auto customer_key = _random_int(1, customer_count);
+    if (customer_count > 2) {
+      while (customer_key % 3 == 0) customer_key = _random_int(1, customer_count);
+    }
+    const auto order_date = _random_int(0, LAST_ORDER_DATE);
+
+    auto total_price = 0.0f;
+    auto shipped_count = 0;
+    const auto lineitem_count = _random_int(1, 7);
+    for (auto line_number = 1; line_number <= lineitem_count; ++line_number) {
+      const auto part_key = _random_int(1, part_count);
+      const auto quantity = static_cast<float>(_random_int(1, 50));
+      const auto extended_price = quantity * retail_price(part_key);
+      const auto discount = _random_decimal(0, 10);
+      const auto tax = _random_decimal(0, 8);
+      const auto ship_date = order_date + _random_int(1, 121);
+      const auto commit_date = order_date + _random_int(30, 90);
+      const auto receipt_date = ship_date + _random_int(1, 30);
+      const auto return_flag = receipt_date <= CURRENT_DATE ? (_random_int(0, 1) == 0 ? "R" : "A") : "N";
+      const auto is_shipped = ship_date <= CURRENT_DATE;
+
+      total_price += extended_price * (1.0f + tax) * (1.0f - discount);
+      shipped_count += is_shipped;
+      lineitem_builder.append_row(order_key, part_key, supplier_of_part(part_key, _random_int(0, 3), supplier_count),
+                                  line_number, quantity, extended_price, discount, tax, return_flag,
+                                  is_shipped ? "F" : "O", DATES[ship_date], DATES[commit_date], DATES[receipt_date],
+                                  _random_element(INSTRUCTIONS), _random_element(MODES), _random_text(10, 43));
+    }
+
+    const auto order_status = shipped_count == lineitem_count ? "F" : (shipped_count == 0 ? "O" : "P");
+    orders_builder.append_row(order_key, customer_key, order_status, total_price, DATES[order_date],
+                              _random_element(PRIORITIES), format_key("Clerk#", _random_int(1, clerk_count)), 0,
+                              _random_text(19, 78));
+  }
+
+  return {orders_builder.finish(), lineitem_builder.finish()};
+}
+
+}  // namespace opossum
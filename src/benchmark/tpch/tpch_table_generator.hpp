@@ -0,0 +1,59 @@
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "storage/table.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// Generates the eight tables of the TPC-H benchmark for a given scale factor. The tables follow the schema, the
+// cardinalities, and the value domains of the TPC-H specification, with some simplifications: texts (names,
+// addresses, comments) are random sequences of words instead of following the grammar of the specification, decimals
+// are stored as floats, and dates as strings in the format YYYY-MM-DD, so that they can be compared lexicographically.
+//
+// The random numbers are drawn from a generator with a fixed seed, so the same scale factor always yields the same
+// data. The tables are generated chunk by chunk and, if requested, every chunk is dictionary-compressed as soon as it
+// is full.
+class TpchTableGenerator {
+ public:
+  explicit TpchTableGenerator(float scale_factor, ChunkOffset chunk_size = 100'000, bool compress = false);
+
+  // returns all tables, mapped by their names (e.g., "lineitem")
+  std::map<std::string, std::shared_ptr<Table>> generate_all_tables();
+
+  // generates all tables and adds them to the StorageManager
+  void generate_and_store();
+
+ protected:
+  int _random_int(int min, int max);
+  float _random_decimal(int min_cents, int max_cents);
+  std::string _random_text(size_t min_length, size_t max_length);
+  std::string _random_phone(int nation_key);
+  const std::string& _random_element(const std::vector<std::string>& elements);
+
+  // the number of rows of a table that has base_row_count rows at scale factor 1
+  size_t _scaled(size_t base_row_count) const;
+
+  std::shared_ptr<Table> _generate_region();
+  std::shared_ptr<Table> _generate_nation();
+  std::shared_ptr<Table> _generate_supplier();
+  std::shared_ptr<Table> _generate_customer();
+  std::shared_ptr<Table> _generate_part();
+  std::shared_ptr<Table> _generate_partsupp();
+  // orders and lineitem are generated together, because the status and the price of an order depend on its items
+  std::pair<std::shared_ptr<Table>, std::shared_ptr<Table>> _generate_orders_and_lineitem();
+
+  const float _scale_factor;
+  const ChunkOffset _chunk_size;
+  const bool _compress;
+  std::mt19937 _random_engine;
+};
+
+}  // namespace opossum
@@ -0,0 +1,64 @@
+#include <unistd.h>
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+#include "benchmark/benchmark.h"
+
+#include "../micro_benchmark_utils.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+#include "utils/load_table.hpp"
+#include "utils/performance_warning.hpp"
+
+namespace opossum {
+
+// writes the generated table to a temporary .tbl file, which the benchmark loads again
+class LoadTableFixture : public MicroBenchmarkTableFixture {
+ public:
+  void SetUp(benchmark::State& state) override {
+    MicroBenchmarkTableFixture::SetUp(state);
+
+    auto file_name = std::string{P_tmpdir} + "/hyrise_load_table_benchmark_XXXXXX";
+    const auto file_descriptor = mkstemp(file_name.data());
+    Assert(file_descriptor != -1, "could not create a temporary file");
+    close(file_descriptor);
+    _file_name = file_name;
+
+    auto file = std::ofstream{_file_name};
+    file << "a|b\nint|string\n";
+    PerformanceWarningDisabler performance_warning_disabler;
+    for (ChunkID chunk_id{0}; chunk_id < _table->chunk_count(); ++chunk_id) {
+      const auto& chunk = _table->get_chunk(chunk_id);
+      const auto& int_segment = *chunk.get_segment(ColumnID{0});
+      const auto& string_segment = *chunk.get_segment(ColumnID{1});
+      for (ChunkOffset chunk_offset{0}; chunk_offset < chunk.size(); ++chunk_offset) {
+        file << int_segment[chunk_offset] << '|' << string_segment[chunk_offset] << '\n';
+      }
+    }
+  }
+
+  void TearDown(benchmark::State& state) override {
+    std::remove(_file_name.c_str());
+    MicroBenchmarkTableFixture::TearDown(state);
+  }
+
+ protected:
+  std::string _file_name;
+};
+
+BENCHMARK_DEFINE_F(LoadTableFixture, LoadTable)(benchmark::State& state) {
+  for (auto _ : state) {
+    auto table = load_table(_file_name, _table->chunk_size());
+    benchmark::DoNotOptimize(table);
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * _table->row_count()));
+}
+// load_table appends every row on its own, so the tables are smaller than for the other benchmarks
+BENCHMARK_REGISTER_F(LoadTableFixture, LoadTable)
+    ->ArgNames({"rows", "chunk_size", "distribution"})
+    ->Args({10'000, 1'000, static_cast<int64_t>(ValueDistribution::Uniform)})
+    ->Args({100'000, 10'000, static_cast<int64_t>(ValueDistribution::Uniform)});
+
+}  // namespace opossum
@@ -1,20 +1,81 @@
 #include "abstract_operator.hpp"
 
+#include <time.h>
+
 #include <chrono>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <typeindex>
+#include <unordered_map>
 #include <vector>
 
 #include "storage/table.hpp"
 #include "utils/assert.hpp"
+#include "utils/metrics.hpp"
+#include "utils/query_arena.hpp"
+#include "utils/tracing.hpp"
 
 namespace opossum {
 
+namespace {
+
+std::chrono::nanoseconds process_cpu_time() {
+  timespec time;
+  clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &time);
+  return std::chrono::seconds{time.tv_sec} + std::chrono::nanoseconds{time.tv_nsec};
+}
+
+// returns the duration histogram of the operator's class, which is looked up in the registry once per thread
+Histogram& duration_histogram(const AbstractOperator& op) {
+  thread_local auto histograms = std::unordered_map<std::type_index, Histogram*>{};
+  auto& histogram = histograms[std::type_index{typeid(op)}];
+  if (!histogram) {
+    histogram = &MetricsRegistry::get().histogram("opossum_operator_duration_seconds",
+                                                  "Walltime of the execution of operators", {{"operator", op.name()}});
+  }
+  return *histogram;
+}
+
+}  // namespace
+
 AbstractOperator::AbstractOperator(const std::shared_ptr<const AbstractOperator> left,
                                    const std::shared_ptr<const AbstractOperator> right)
     : _input_left(left), _input_right(right) {}
 
-void AbstractOperator::execute() { _output = _on_execute(); }
+void AbstractOperator::execute() {
+  TRACE_SPAN("operator", description());
+  const auto allocated_bytes_before = QueryArena::allocated_bytes();
+  const auto cpu_time_before = process_cpu_time();
+  const auto walltime_before = std::chrono::steady_clock::now();
+  const auto hardware_counters_before = HardwareCounters::read();
+
+  _output = _on_execute();
+
+  _performance_data.hardware_counters = HardwareCounters::read() - hardware_counters_before;
+  _performance_data.walltime = std::chrono::steady_clock::now() - walltime_before;
+  _performance_data.cpu_time = process_cpu_time() - cpu_time_before;
+  _performance_data.allocated_bytes = QueryArena::allocated_bytes() - allocated_bytes_before;
+  _performance_data.pruned_chunk_count = _pruned_chunk_count;
+  {
+    std::lock_guard lock(_hardware_counters_mutex);
+    _performance_data.hardware_counters += _registered_hardware_counters;
+    _performance_data.kernel_hardware_counters = _kernel_hardware_counters;
+  }
+
+  for (const auto& input : {_input_left, _input_right}) {
+    if (!input || !input->get_output()) continue;
+    _performance_data.input_row_count += input->get_output()->row_count();
+    _performance_data.input_chunk_count += input->get_output()->chunk_count();
+  }
+  if (_output) {
+    _performance_data.output_row_count = _output->row_count();
+    _performance_data.output_chunk_count = _output->chunk_count();
+  }
+  _performance_data.executed = true;
+
+  duration_histogram(*this).observe(std::chrono::duration<double>{_performance_data.walltime}.count());
+}
 
 std::shared_ptr<const Table> AbstractOperator::get_output() const {
   // TODO(anyone): You should place some meaningful checks here
@@ -22,6 +83,17 @@ std::shared_ptr<const Table> AbstractOperator::get_output() const {
   return _output;
 }
 
+std::string AbstractOperator::description() const { return name(); }
+
+const OperatorPerformanceData& AbstractOperator::performance_data() const { return _performance_data; }
+
+uint64_t AbstractOperator::pruned_chunk_count() const { return _pruned_chunk_count; }
+
+HardwareCounterValues AbstractOperator::kernel_hardware_counters() const {
+  std::lock_guard lock(_hardware_counters_mutex);
+  return _kernel_hardware_counters;
+}
+
 std::shared_ptr<const AbstractOperator> AbstractOperator::input_left() const { return _input_left; }
 
 std::shared_ptr<const AbstractOperator> AbstractOperator::input_right() const { return _input_right; }
@@ -30,4 +102,23 @@ std::shared_ptr<const Table> AbstractOperator::_input_table_left() const { retur
 
 std::shared_ptr<const Table> AbstractOperator::_input_table_right() const { return _input_right->get_output(); }
 
+void AbstractOperator::_register_pruned_chunk() const {
+  static auto& pruned_chunks =
+      MetricsRegistry::get().counter("opossum_chunks_pruned_total", "Number of chunks that operators skipped");
+  pruned_chunks.increment();
+  ++_pruned_chunk_count;
+}
+
+void AbstractOperator::_register_hardware_counters(const HardwareCounterValues& hardware_counters) const {
+  if (!hardware_counters.available) return;
+  std::lock_guard lock(_hardware_counters_mutex);
+  _registered_hardware_counters += hardware_counters;
+}
+
+void AbstractOperator::_register_kernel_hardware_counters(const HardwareCounterValues& hardware_counters) const {
+  if (!hardware_counters.available) return;
+  std::lock_guard lock(_hardware_counters_mutex);
+  _kernel_hardware_counters += hardware_counters;
+}
+
 }  // namespace opossum
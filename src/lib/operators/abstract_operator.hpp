@@ -1,15 +1,43 @@
 #pragma once
 
+#include <atomic>
+#include <chrono>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
 #include "types.hpp"
+#include "utils/hardware_counters.hpp"
 
 namespace opossum {
 
 class Table;
 
+// Performance data that AbstractOperator::execute records for every operator. Row and chunk counts of the input are
+// summed over both inputs.
+struct OperatorPerformanceData {
+  bool executed = false;
+  std::chrono::nanoseconds walltime{0};
+  // CPU time of the whole process, which includes the worker threads of parallel operators, but also other queries
+  // that run concurrently
+  std::chrono::nanoseconds cpu_time{0};
+  uint64_t input_row_count = 0;
+  uint64_t input_chunk_count = 0;
+  uint64_t output_row_count = 0;
+  uint64_t output_chunk_count = 0;
+  // bytes allocated by the executing thread from the memory resource for intermediate results (see QueryArena)
+  size_t allocated_bytes = 0;
+  // number of chunks that the operator skipped without looking at their rows, e.g., because their dictionary shows
+  // that no row can match
+  uint64_t pruned_chunk_count = 0;
+  // hardware counters (see HardwareCounters) of the executing thread and of threads that worked for the operator
+  HardwareCounterValues hardware_counters;
+  // hardware counters of the segment-level kernels of the operator, e.g., the loops that compare the values of a
+  // segment in a TableScan, including those that ran as part of a Pipeline
+  HardwareCounterValues kernel_hardware_counters;
+};
+
 // AbstractOperator is the abstract super class for all operators.
 // All operators have up to two input tables and one output table.
 // Their lifecycle has three phases:
@@ -41,6 +69,22 @@ class AbstractOperator : private Noncopyable {
   // returns the result of the operator
   std::shared_ptr<const Table> get_output() const;
 
+  // the name of the operator class, e.g., "TableScan"
+  virtual std::string name() const = 0;
+
+  // a one-line description of the operator and its parameters for plan reports, by default its name
+  virtual std::string description() const;
+
+  // performance data of the execution, see OperatorPerformanceData
+  const OperatorPerformanceData& performance_data() const;
+
+  // returns the number of chunks pruned so far, which includes chunks pruned while the operator was part of a Pipeline
+  uint64_t pruned_chunk_count() const;
+
+  // returns the hardware counters of the kernels so far, which includes kernels run while the operator was part of a
+  // Pipeline
+  HardwareCounterValues kernel_hardware_counters() const;
+
   // Get the input operators.
   std::shared_ptr<const AbstractOperator> input_left() const;
   std::shared_ptr<const AbstractOperator> input_right() const;
@@ -54,12 +98,27 @@ class AbstractOperator : private Noncopyable {
   std::shared_ptr<const Table> _input_table_left() const;
   std::shared_ptr<const Table> _input_table_right() const;
 
+  // to be called by operators for every chunk that they prune, may be called concurrently and outside of execute
+  // (e.g., by a Pipeline)
+  void _register_pruned_chunk() const;
+
+  // to be called by operators with the hardware counters of work that they did on other threads (e.g., by a Pipeline)
+  // and of their segment-level kernels, may be called concurrently
+  void _register_hardware_counters(const HardwareCounterValues& hardware_counters) const;
+  void _register_kernel_hardware_counters(const HardwareCounterValues& hardware_counters) const;
+
   // Shared pointers to input operators, can be nullptr.
   std::shared_ptr<const AbstractOperator> _input_left;
   std::shared_ptr<const AbstractOperator> _input_right;
 
   // Is nullptr until the operator is executed
   std::shared_ptr<const Table> _output;
+
+  OperatorPerformanceData _performance_data;
+  mutable std::atomic<uint64_t> _pruned_chunk_count{0};
+  mutable HardwareCounterValues _registered_hardware_counters;
+  mutable HardwareCounterValues _kernel_hardware_counters;
+  mutable std::mutex _hardware_counters_mutex;
 };
 
 }  // namespace opossum
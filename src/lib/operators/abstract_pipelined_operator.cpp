@@ -0,0 +1,31 @@
+#include "abstract_pipelined_operator.hpp"
+
+#include <memory>
+#include <utility>
+
+#include "storage/table.hpp"
+
+namespace opossum {
+
+void AbstractPipelinedOperator::prepare(const Table& input_table) const {}
+
+std::shared_ptr<Table> AbstractPipelinedOperator::create_output_table(const Table& input_table) const {
+  auto output_table = std::make_shared<Table>();
+  for (ColumnID column_id{0}; column_id < input_table.column_count(); ++column_id) {
+    output_table->add_column(input_table.column_name(column_id), input_table.column_type(column_id));
+  }
+  return output_table;
+}
+
+std::shared_ptr<const Table> AbstractPipelinedOperator::_on_execute() {
+  const auto input_table = _input_table_left();
+  auto output_table = create_output_table(*input_table);
+  prepare(*input_table);
+  for (ChunkID chunk_id{0}; chunk_id < input_table->chunk_count(); ++chunk_id) {
+    auto output_chunk = execute_on_chunk(input_table, chunk_id, input_table->get_chunk(chunk_id));
+    if (output_chunk) output_table->emplace_chunk(std::move(*output_chunk));
+  }
+  return output_table;
+}
+
+}  // namespace opossum
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+
+#include "abstract_operator.hpp"
+#include "storage/chunk.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+
+// AbstractPipelinedOperator is the super class of operators that process each chunk of their input independently,
+// e.g., scans. Such operators can be fused into a Pipeline, which passes every chunk through all of them before the
+// next chunk is processed, instead of materializing a table after each operator.
+//
+// When a pipelined operator is executed on its own, it calls execute_on_chunk for the chunks of its input one by one.
+// In both cases, prepare is called once before, so that work that does not depend on the chunk is not repeated.
+class AbstractPipelinedOperator : public AbstractOperator {
+ public:
+  using AbstractOperator::AbstractOperator;
+
+  // Processes one chunk and returns the resulting chunk, or std::nullopt if no rows remain. input_table provides the
+  // column definitions of the input. The chunk is either the chunk chunk_id of input_table or, within a pipeline, a
+  // chunk produced by the previous operator, which only consists of reference segments and is not part of any table.
+  // Implementations must be thread-safe, because a pipeline processes multiple chunks in parallel.
+  virtual std::optional<Chunk> execute_on_chunk(const std::shared_ptr<const Table>& input_table, const ChunkID chunk_id,
+                                                const Chunk& chunk) const = 0;
+
+  // Prepares the processing of chunks with the columns of input_table, e.g., by resolving the implementation for the
+  // column types, and has to be called before execute_on_chunk. It may be called repeatedly and concurrently.
+  virtual void prepare(const Table& input_table) const;
+
+  // returns an empty table with the columns of the output for an input with the columns of input_table
+  // by default, the output has the same columns as the input
+  virtual std::shared_ptr<Table> create_output_table(const Table& input_table) const;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+};
+
+}  // namespace opossum
@@ -0,0 +1,167 @@
+#include "export.hpp"
+
+#include <charconv>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "operators/export_binary.hpp"
+#include "resolve_type.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/fitted_attribute_vector.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "storage/value_vector.hpp"
+#include "utils/assert.hpp"
+#include "utils/buffered_writer.hpp"
+
+namespace opossum {
+
+namespace {
+
+// The text representation of all values of one column of a chunk. Formatting whole columns keeps the type
+// resolution and the segment access out of the per-row loop, which only copies the formatted values.
+struct FormattedColumn {
+  std::vector<char> text;
+  // end offset of each value in text, the value begins where its predecessor ends
+  std::vector<size_t> value_ends;
+};
+
+template <typename T>
+void _format_value(const T& value, FormattedColumn& column, const char delimiter) {
+  // strings are passed as the string_views of their StringVectors
+  if constexpr (std::is_same_v<T, std::string_view>) {
+    Assert(value.find_first_of(std::string{delimiter} + "\r\n") == std::string_view::npos,
+           "Export: String value '" + std::string{value} + "' cannot be written without quoting");
+    column.text.insert(column.text.end(), value.cbegin(), value.cend());
+  } else {
+    // large enough for the shortest round-trip representation of all our numeric types
+    constexpr auto max_length = size_t{32};
+    const auto offset = column.text.size();
+    column.text.resize(offset + max_length);
+    const auto result = std::to_chars(column.text.data() + offset, column.text.data() + offset + max_length, value);
+    DebugAssert(result.ec == std::errc{}, "value could not be formatted");
+    column.text.resize(static_cast<size_t>(result.ptr - column.text.data()));
+  }
+  column.value_ends.push_back(column.text.size());
+}
+
+template <typename T, typename AttributeVectorType>
+void _format_dictionary_values(const ValueVector<T>& dictionary,
+                               const std::shared_ptr<const BaseAttributeVector>& attribute_vector,
+                               FormattedColumn& column, const char delimiter) {
+  const auto fitted_attribute_vector =
+      std::static_pointer_cast<const FittedAttributeVector<AttributeVectorType>>(attribute_vector);
+  for (const auto value_id : fitted_attribute_vector->values()) {
+    _format_value(dictionary[value_id], column, delimiter);
+  }
+}
+
+template <typename T>
+FormattedColumn _format_segment(const std::shared_ptr<BaseSegment>& segment, const char delimiter) {
+  auto column = FormattedColumn{};
+  column.value_ends.reserve(segment->size());
+
+  if (const auto value_segment = std::dynamic_pointer_cast<const ValueSegment<T>>(segment)) {
+    for (const auto& value : value_segment->values()) {
+      _format_value(value, column, delimiter);
+    }
+  } else if (const auto dictionary_segment = std::dynamic_pointer_cast<const DictionarySegment<T>>(segment)) {
+    const auto& dictionary = *dictionary_segment->dictionary();
+    const auto attribute_vector = dictionary_segment->attribute_vector();
+    switch (attribute_vector->width()) {
+      case sizeof(uint8_t):
+        _format_dictionary_values<T, uint8_t>(dictionary, attribute_vector, column, delimiter);
+        break;
+      case sizeof(uint16_t):
+        _format_dictionary_values<T, uint16_t>(dictionary, attribute_vector, column, delimiter);
+        break;
+      case sizeof(uint32_t):
+        _format_dictionary_values<T, uint32_t>(dictionary, attribute_vector, column, delimiter);
+        break;
+      default:
+        Fail("unsupported attribute vector width: " + std::to_string(attribute_vector->width()));
+    }
+  } else if (const auto reference_segment = std::dynamic_pointer_cast<const ReferenceSegment>(segment)) {
+    for (const auto& value : reference_segment->materialize_values<T>()) {
+      _format_value(value, column, delimiter);
+    }
+  } else {
+    Fail("unknown segment type");
+  }
+
+  return column;
+}
+
+void _write_header_line(BufferedWriter& writer, const std::vector<std::string>& fields, const char delimiter) {
+  for (auto field_id = size_t{0}; field_id < fields.size(); ++field_id) {
+    if (field_id > 0) writer.write_value(delimiter);
+    writer.write(fields[field_id]);
+  }
+  writer.write_value('\n');
+}
+
+void _write_csv(const Table& table, BufferedWriter& writer, const char delimiter) {
+  auto column_types = std::vector<std::string>{};
+  for (ColumnID column_id{0}; column_id < table.column_count(); ++column_id) {
+    column_types.push_back(table.column_type(column_id));
+  }
+  _write_header_line(writer, table.column_names(), delimiter);
+  _write_header_line(writer, column_types, delimiter);
+
+  for (ChunkID chunk_id{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+    const auto& chunk = table.get_chunk(chunk_id);
+
+    // an empty table's chunk might be missing actual segments
+    if (chunk.size() == 0) continue;
+
+    auto columns = std::vector<FormattedColumn>{};
+    columns.reserve(table.column_count());
+    for (ColumnID column_id{0}; column_id < table.column_count(); ++column_id) {
+      resolve_data_type(column_types[column_id], [&](auto type) {
+        using Type = typename decltype(type)::type;
+        columns.push_back(_format_segment<Type>(chunk.get_segment(column_id), delimiter));
+      });
+    }
+
+    for (ChunkOffset chunk_offset{0}; chunk_offset < chunk.size(); ++chunk_offset) {
+      for (ColumnID column_id{0}; column_id < table.column_count(); ++column_id) {
+        const auto& column = columns[column_id];
+        const auto value_begin = chunk_offset == 0 ? size_t{0} : column.value_ends[chunk_offset - 1];
+        writer.write(column.text.data() + value_begin, column.value_ends[chunk_offset] - value_begin);
+        writer.write_value(column_id + 1 < table.column_count() ? delimiter : '\n');
+      }
+    }
+  }
+}
+
+}  // namespace
+
+Export::Export(const std::shared_ptr<const AbstractOperator> in, const int file_descriptor, const ExportFormat format,
+               const char delimiter)
+    : AbstractOperator(in), _file_descriptor(file_descriptor), _format(format), _delimiter(delimiter) {}
+
+std::string Export::name() const { return "Export"; }
+
+void Export::write_table(const Table& table, const int file_descriptor, const ExportFormat format,
+                         const char delimiter) {
+  BufferedWriter writer(file_descriptor);
+  switch (format) {
+    case ExportFormat::Csv:
+      _write_csv(table, writer, delimiter);
+      break;
+    case ExportFormat::Binary:
+      ExportBinary::write_table(table, writer);
+      break;
+  }
+  writer.flush();
+}
+
+std::shared_ptr<const Table> Export::_on_execute() {
+  write_table(*_input_table_left(), _file_descriptor, _format, _delimiter);
+  return _input_table_left();
+}
+
+}  // namespace opossum
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <memory>
+
+#include "abstract_operator.hpp"
+
+namespace opossum {
+
+enum class ExportFormat { Csv, Binary };
+
+/**
+ * Operator that streams the table of its input operator to a file descriptor, e.g., a file, a pipe or a socket.
+ * The file descriptor is neither closed nor rewound.
+ *
+ * Csv:    The output can be read by ImportCsv: a line of column names, a line of column types and one line per row,
+ *         separated by the given delimiter. Strings are not quoted, so they must not contain the delimiter or line
+ *         breaks.
+ * Binary: The output has the format of ExportBinary (see there) and can be read by ImportBinary.
+ *
+ * In contrast to Print, values are never boxed in AllTypeVariants. Each chunk is processed column by column by typed
+ * writers (ReferenceSegments are resolved without operator[]), and the output is passed on in large buffered writes.
+ */
+class Export : public AbstractOperator {
+ public:
+  Export(const std::shared_ptr<const AbstractOperator> in, const int file_descriptor,
+         const ExportFormat format = ExportFormat::Csv, const char delimiter = '|');
+
+  // writes the given table to the given file descriptor, can be used without an operator pipeline
+  static void write_table(const Table& table, const int file_descriptor, const ExportFormat format = ExportFormat::Csv,
+                          const char delimiter = '|');
+
+  std::string name() const override;
+
+ protected:
+  // returns the input table so that it can be passed on to the next operator
+  std::shared_ptr<const Table> _on_execute() override;
+
+  const int _file_descriptor;
+  const ExportFormat _format;
+  const char _delimiter;
+};
+
+}  // namespace opossum
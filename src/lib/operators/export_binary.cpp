@@ -0,0 +1,170 @@
+#include "export_binary.hpp"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/fitted_attribute_vector.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "storage/value_vector.hpp"
+#include "utils/assert.hpp"
+#include "utils/buffered_writer.hpp"
+#include "utils/file_descriptor_guard.hpp"
+
+namespace opossum {
+
+namespace {
+
+void _write_string(BufferedWriter& writer, const std::string& value) {
+  DebugAssert(value.size() <= std::numeric_limits<uint32_t>::max(), "string is too long");
+  writer.write_value(static_cast<uint32_t>(value.size()));
+  writer.write(value);
+}
+
+template <typename T, typename Allocator>
+void _write_values(BufferedWriter& writer, const std::vector<T, Allocator>& values) {
+  writer.write(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(T));
+}
+
+template <typename Allocator>
+void _write_values(BufferedWriter& writer, const std::vector<std::string, Allocator>& values) {
+  auto lengths = std::vector<uint32_t>{};
+  lengths.reserve(values.size());
+  for (const auto& value : values) {
+    DebugAssert(value.size() <= std::numeric_limits<uint32_t>::max(), "string is too long");
+    lengths.push_back(static_cast<uint32_t>(value.size()));
+  }
+  _write_values(writer, lengths);
+
+  for (const auto& value : values) {
+    writer.write(value);
+  }
+}
+
+// the format of a string list matches the layout of a StringVector, so that the characters are written at once
+void _write_values(BufferedWriter& writer, const StringVector& values) {
+  auto lengths = std::vector<uint32_t>{};
+  lengths.reserve(values.size());
+  auto begin = size_t{0};
+  for (const auto end : values.ends()) {
+    DebugAssert(end - begin <= std::numeric_limits<uint32_t>::max(), "string is too long");
+    lengths.push_back(static_cast<uint32_t>(end - begin));
+    begin = end;
+  }
+  _write_values(writer, lengths);
+  writer.write(values.characters().data(), values.characters().size());
+}
+
+template <typename T>
+void _write_dictionary_segment(BufferedWriter& writer, const DictionarySegment<T>& segment,
+                               const bool write_dictionary) {
+  writer.write_value(EncodingType::Dictionary);
+
+  const auto attribute_vector = segment.attribute_vector();
+  writer.write_value(attribute_vector->width());
+  if (write_dictionary) {
+    writer.write_value(static_cast<uint32_t>(segment.unique_values_count()));
+    _write_values(writer, *segment.dictionary());
+  } else {
+    writer.write_value(uint32_t{0});
+  }
+
+  switch (attribute_vector->width()) {
+    case sizeof(uint8_t):
+      _write_values(writer,
+                    std::static_pointer_cast<const FittedAttributeVector<uint8_t>>(attribute_vector)->values());
+      break;
+    case sizeof(uint16_t):
+      _write_values(writer,
+                    std::static_pointer_cast<const FittedAttributeVector<uint16_t>>(attribute_vector)->values());
+      break;
+    case sizeof(uint32_t):
+      _write_values(writer,
+                    std::static_pointer_cast<const FittedAttributeVector<uint32_t>>(attribute_vector)->values());
+      break;
+    default:
+      Fail("unsupported attribute vector width: " + std::to_string(attribute_vector->width()));
+  }
+}
+
+template <typename T>
+void _write_segment(BufferedWriter& writer, const std::shared_ptr<BaseSegment>& segment, const bool write_dictionary) {
+  if (const auto value_segment = std::dynamic_pointer_cast<const ValueSegment<T>>(segment)) {
+    writer.write_value(EncodingType::Unencoded);
+    _write_values(writer, value_segment->values());
+  } else if (const auto dictionary_segment = std::dynamic_pointer_cast<const DictionarySegment<T>>(segment)) {
+    _write_dictionary_segment(writer, *dictionary_segment, write_dictionary);
+  } else if (const auto reference_segment = std::dynamic_pointer_cast<const ReferenceSegment>(segment)) {
+    writer.write_value(EncodingType::Unencoded);
+    _write_values(writer, reference_segment->materialize_values<T>());
+  } else {
+    Fail("unknown segment type");
+  }
+}
+
+}  // namespace
+
+ExportBinary::ExportBinary(const std::shared_ptr<const AbstractOperator> in, const std::string& file_name)
+    : AbstractOperator(in), _file_name(file_name) {}
+
+std::string ExportBinary::name() const { return "ExportBinary"; }
+
+std::string ExportBinary::description() const { return name() + " " + _file_name; }
+
+void ExportBinary::write_table(const Table& table, const std::string& file_name) {
+  const auto file_descriptor = open(file_name.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  Assert(file_descriptor >= 0, "ExportBinary: Could not open file " + file_name);
+  FileDescriptorGuard file_descriptor_guard(file_descriptor);
+
+  BufferedWriter writer(file_descriptor);
+  write_table(table, writer);
+  writer.flush();
+  Assert(file_descriptor_guard.close() == 0, "ExportBinary: Could not close file " + file_name);
+}
+
+void ExportBinary::write_table(const Table& table, BufferedWriter& writer) {
+  writer.write_value(table.chunk_size());
+  writer.write_value(table.column_count());
+  writer.write_value(static_cast<ChunkID::base_type>(table.chunk_count()));
+  for (ColumnID column_id{0}; column_id < table.column_count(); ++column_id) {
+    _write_string(writer, table.column_type(column_id));
+  }
+  for (ColumnID column_id{0}; column_id < table.column_count(); ++column_id) {
+    _write_string(writer, table.column_name(column_id));
+  }
+
+  for (ChunkID chunk_id{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+    const auto& chunk = table.get_chunk(chunk_id);
+    writer.write_value(chunk.size());
+
+    // an empty table's chunk might be missing actual segments
+    if (chunk.size() == 0) continue;
+
+    for (ColumnID column_id{0}; column_id < table.column_count(); ++column_id) {
+      write_segment(chunk.get_segment(column_id), table.column_type(column_id), writer);
+    }
+  }
+}
+
+void ExportBinary::write_segment(const std::shared_ptr<BaseSegment>& segment, const std::string& column_type,
+                                 BufferedWriter& writer, const bool write_dictionary) {
+  resolve_data_type(column_type, [&](auto type) {
+    using Type = typename decltype(type)::type;
+    _write_segment<Type>(writer, segment, write_dictionary);
+  });
+}
+
+std::shared_ptr<const Table> ExportBinary::_on_execute() {
+  write_table(*_input_table_left(), _file_name);
+  return _input_table_left();
+}
+
+}  // namespace opossum
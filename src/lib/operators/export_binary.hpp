@@ -0,0 +1,67 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "abstract_operator.hpp"
+
+namespace opossum {
+
+class BaseSegment;
+class BufferedWriter;
+
+/**
+ * Operator that writes the table of its input operator into a binary file, which can be loaded much faster than a
+ * text file using ImportBinary. The encoding of each segment is kept, i.e., DictionarySegments are written together
+ * with their dictionary and attribute vector. ReferenceSegments are materialized into value segments.
+ *
+ * All numbers are written in the native byte order of the machine. The file has the following format:
+ *
+ * Header
+ *   uint32_t   chunk size
+ *   uint16_t   column count
+ *   uint32_t   chunk count
+ *   string[]   column types, one per column
+ *   string[]   column names, one per column
+ *
+ * Chunk (repeated chunk count times)
+ *   uint32_t   row count
+ *   Segment[]  one per column
+ *
+ * Segment
+ *   uint8_t    EncodingType
+ *   Unencoded:   values[row count]
+ *   Dictionary:  uint8_t attribute vector width, uint32_t dictionary size, values[dictionary size],
+ *                value ids[row count] of the given width
+ *
+ * A string is written as its uint32_t length followed by its characters. A list of values of a fixed-width type is
+ * written as a contiguous array. A list of string values is written as an array of uint32_t lengths followed by the
+ * concatenated characters of all strings.
+ */
+class ExportBinary : public AbstractOperator {
+ public:
+  ExportBinary(const std::shared_ptr<const AbstractOperator> in, const std::string& file_name);
+
+  // writes the given table to the given file, can be used without an operator pipeline
+  static void write_table(const Table& table, const std::string& file_name);
+
+  // writes the given table to the given writer, which is not flushed
+  static void write_table(const Table& table, BufferedWriter& writer);
+
+  // writes a single segment of the given column type in the segment format described above
+  // without write_dictionary, dictionary segments are written with an empty dictionary, e.g., by the BufferManager for
+  // dictionaries that it keeps in memory because they are shared with other segments
+  static void write_segment(const std::shared_ptr<BaseSegment>& segment, const std::string& column_type,
+                            BufferedWriter& writer, bool write_dictionary = true);
+
+  std::string name() const override;
+  std::string description() const override;
+
+ protected:
+  // returns the input table so that it can be passed on to the next operator
+  std::shared_ptr<const Table> _on_execute() override;
+
+  const std::string _file_name;
+};
+
+}  // namespace opossum
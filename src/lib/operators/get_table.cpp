@@ -2,6 +2,7 @@
 
 #include <memory>
 #include <string>
+#include <utility>
 
 #include "storage/storage_manager.hpp"
 
@@ -9,7 +10,17 @@ namespace opossum {
 
 GetTable::GetTable(const std::string& name) : _table_name(name) {}
 
-std::shared_ptr<const Table> GetTable::_on_execute() { return StorageManager::get().get_table(_table_name); }
+GetTable::GetTable(const std::string& name, std::shared_ptr<const Table> table)
+    : _table_name(name), _table(std::move(table)) {}
+
+std::string GetTable::name() const { return "GetTable"; }
+
+std::string GetTable::description() const { return name() + " " + _table_name; }
+
+std::shared_ptr<const Table> GetTable::_on_execute() {
+  if (_table) return _table;
+  return StorageManager::get().get_table(_table_name);
+}
 
 const std::string& GetTable::table_name() const { return _table_name; }
 
@@ -13,10 +13,17 @@ class GetTable : public AbstractOperator {
  public:
   explicit GetTable(const std::string& name);
 
+  // returns the given table, which has already been retrieved from the StorageManager, e.g., by a PreparedPlan
+  GetTable(const std::string& name, std::shared_ptr<const Table> table);
+
   const std::string& table_name() const;
 
+  std::string name() const override;
+  std::string description() const override;
+
  protected:
   std::shared_ptr<const Table> _on_execute() override;
   const std::string _table_name;
+  const std::shared_ptr<const Table> _table;
 };
 }  // namespace opossum
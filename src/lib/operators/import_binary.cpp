@@ -0,0 +1,126 @@
+#include "import_binary.hpp"
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/chunk.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/fitted_attribute_vector.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/assert.hpp"
+#include "utils/binary_reader.hpp"
+#include "utils/mapped_file.hpp"
+
+namespace opossum {
+
+namespace {
+
+template <typename T>
+std::shared_ptr<BaseSegment> _read_dictionary_segment(BinaryReader& reader, const uint32_t row_count) {
+  const auto attribute_vector_width = reader.read_value<AttributeVectorWidth>();
+  const auto dictionary_size = reader.read_value<uint32_t>();
+  auto dictionary = std::make_shared<ValueVector<T>>(reader.read_values<T>(dictionary_size));
+
+  auto attribute_vector = std::shared_ptr<BaseAttributeVector>{};
+  switch (attribute_vector_width) {
+    case sizeof(uint8_t):
+      attribute_vector = std::make_shared<FittedAttributeVector<uint8_t>>(reader.read_values<uint8_t>(row_count));
+      break;
+    case sizeof(uint16_t):
+      attribute_vector = std::make_shared<FittedAttributeVector<uint16_t>>(reader.read_values<uint16_t>(row_count));
+      break;
+    case sizeof(uint32_t):
+      attribute_vector = std::make_shared<FittedAttributeVector<uint32_t>>(reader.read_values<uint32_t>(row_count));
+      break;
+    default:
+      Fail("ImportBinary: Unsupported attribute vector width: " + std::to_string(attribute_vector_width));
+  }
+
+  return std::make_shared<DictionarySegment<T>>(std::move(dictionary), std::move(attribute_vector));
+}
+
+template <typename T>
+std::shared_ptr<BaseSegment> _read_segment(BinaryReader& reader, const uint32_t row_count) {
+  const auto encoding_type = reader.read_value<EncodingType>();
+  switch (encoding_type) {
+    case EncodingType::Unencoded:
+      return std::make_shared<ValueSegment<T>>(reader.read_values<T>(row_count));
+    case EncodingType::Dictionary:
+      return _read_dictionary_segment<T>(reader, row_count);
+  }
+  Fail("ImportBinary: Unknown encoding type");
+  return nullptr;
+}
+
+}  // namespace
+
+ImportBinary::ImportBinary(const std::string& file_name, const std::optional<std::string> table_name)
+    : _file_name(file_name), _table_name(table_name) {}
+
+std::string ImportBinary::name() const { return "ImportBinary"; }
+
+std::string ImportBinary::description() const { return name() + " " + _file_name; }
+
+std::shared_ptr<Table> ImportBinary::read_table(const std::string& file_name) {
+  const MappedFile file(file_name);
+  BinaryReader reader(file.view());
+
+  const auto chunk_size = reader.read_value<uint32_t>();
+  const auto column_count = reader.read_value<uint16_t>();
+  const auto chunk_count = reader.read_value<ChunkID::base_type>();
+
+  auto column_types = std::vector<std::string>{};
+  column_types.reserve(column_count);
+  for (ColumnID column_id{0}; column_id < column_count; ++column_id) {
+    column_types.push_back(reader.read_string());
+  }
+
+  auto table = std::make_shared<Table>(chunk_size);
+  for (ColumnID column_id{0}; column_id < column_count; ++column_id) {
+    table->add_column(reader.read_string(), column_types[column_id]);
+  }
+
+  for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto row_count = reader.read_value<uint32_t>();
+    if (row_count == 0) continue;
+
+    Chunk chunk;
+    for (ColumnID column_id{0}; column_id < column_count; ++column_id) {
+      chunk.add_segment(read_segment(reader, column_types[column_id], row_count));
+    }
+    table->emplace_chunk(std::move(chunk));
+  }
+
+  Assert(reader.at_end(), "ImportBinary: Unexpected data at the end of file " + file_name);
+  return table;
+}
+
+std::shared_ptr<BaseSegment> ImportBinary::read_segment(BinaryReader& reader, const std::string& column_type,
+                                                       const uint32_t row_count) {
+  auto segment = std::shared_ptr<BaseSegment>{};
+  resolve_data_type(column_type, [&](auto type) {
+    using Type = typename decltype(type)::type;
+    segment = _read_segment<Type>(reader, row_count);
+  });
+  return segment;
+}
+
+std::shared_ptr<const Table> ImportBinary::_on_execute() {
+  if (_table_name && StorageManager::get().has_table(*_table_name)) {
+    return StorageManager::get().get_table(*_table_name);
+  }
+
+  const auto table = read_table(_file_name);
+  if (_table_name) {
+    StorageManager::get().add_table(*_table_name, table);
+  }
+  return table;
+}
+
+}  // namespace opossum
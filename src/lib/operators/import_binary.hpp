@@ -0,0 +1,45 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string>
+
+#include "abstract_operator.hpp"
+
+namespace opossum {
+
+class BaseSegment;
+class BinaryReader;
+
+/**
+ * Operator that loads a table from a binary file written by ExportBinary (see there for the file format).
+ *
+ * The file is memory-mapped and the segments are created from the mapped buffers directly. In contrast to load_table,
+ * no values have to be parsed and no AllTypeVariants are created, so that the import is mostly bound by the speed at
+ * which the pages of the file can be read.
+ *
+ * If a table name is given, the table is added to the StorageManager. If the StorageManager already holds a table
+ * with that name, that table is returned instead.
+ */
+class ImportBinary : public AbstractOperator {
+ public:
+  explicit ImportBinary(const std::string& file_name, const std::optional<std::string> table_name = std::nullopt);
+
+  // reads the table from the given file, can be used without an operator pipeline
+  static std::shared_ptr<Table> read_table(const std::string& file_name);
+
+  // reads a single segment of the given column type as written by ExportBinary::write_segment
+  static std::shared_ptr<BaseSegment> read_segment(BinaryReader& reader, const std::string& column_type,
+                                                   const uint32_t row_count);
+
+  std::string name() const override;
+  std::string description() const override;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  const std::string _file_name;
+  const std::optional<std::string> _table_name;
+};
+
+}  // namespace opossum
@@ -0,0 +1,229 @@
+#include "import_csv.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "scheduler/chunk_workers.hpp"
+#include "scheduler/topology.hpp"
+#include "storage/chunk.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/assert.hpp"
+#include "utils/mapped_file.hpp"
+
+namespace opossum {
+
+namespace {
+
+// blocks smaller than this are not worth the overhead of a separate thread
+constexpr size_t MIN_BLOCK_SIZE = 1 << 20;
+
+// Collects the values of one column of a chunk as their actual type before they are turned into a segment
+class BaseColumnBuilder {
+ public:
+  virtual ~BaseColumnBuilder() = default;
+
+  virtual void reserve(const size_t row_count) = 0;
+
+  virtual void append(const std::string_view field) = 0;
+
+  virtual std::shared_ptr<BaseSegment> build_segment(const bool compress) = 0;
+};
+
+template <typename T>
+class ColumnBuilder : public BaseColumnBuilder {
+ public:
+  void reserve(const size_t row_count) override { _values.reserve(row_count); }
+
+  void append(const std::string_view field) override {
+    if constexpr (std::is_same_v<T, std::string>) {
+      _values.emplace_back(field);
+    } else {
+      auto value = T{};
+      const auto field_end = field.data() + field.size();
+      const auto result = std::from_chars(field.data(), field_end, value);
+      Assert(result.ec == std::errc{} && result.ptr == field_end,
+             "ImportCsv: Could not convert '" + std::string{field} + "'");
+      _values.push_back(value);
+    }
+  }
+
+  std::shared_ptr<BaseSegment> build_segment(const bool compress) override {
+    auto value_segment = std::make_shared<ValueSegment<T>>(std::move(_values));
+    if (!compress) return value_segment;
+    return std::make_shared<DictionarySegment<T>>(value_segment);
+  }
+
+ protected:
+  ValueVector<T> _values;
+};
+
+// removes the first line from the given text and returns it without the line break
+std::string_view _consume_line(std::string_view& text) {
+  const auto line_end = std::min(text.find('\n'), text.size());
+  auto line = text.substr(0, line_end);
+  text.remove_prefix(std::min(line_end + 1, text.size()));
+  if (!line.empty() && line.back() == '\r') line.remove_suffix(1);
+  return line;
+}
+
+std::vector<std::string> _split_header_line(std::string_view line, const char delimiter) {
+  auto fields = std::vector<std::string>{};
+  while (true) {
+    const auto field_end = line.find(delimiter);
+    fields.emplace_back(line.substr(0, field_end));
+    if (field_end == std::string_view::npos) break;
+    line.remove_prefix(field_end + 1);
+  }
+  return fields;
+}
+
+// Returns the offsets of all lines in the given data. The data is split into newline-aligned blocks, which are
+// scanned in parallel.
+std::vector<size_t> _find_line_starts(const std::string_view data, const size_t worker_count) {
+  if (data.empty()) return {};
+
+  auto block_starts = std::vector<size_t>{0};
+  const auto block_size = std::max(data.size() / worker_count, MIN_BLOCK_SIZE);
+  while (block_starts.back() + block_size < data.size()) {
+    const auto newline = data.find('\n', block_starts.back() + block_size);
+    if (newline == std::string_view::npos || newline + 1 >= data.size()) break;
+    block_starts.push_back(newline + 1);
+  }
+  block_starts.push_back(data.size());
+
+  const auto block_count = block_starts.size() - 1;
+  auto line_starts_per_block = std::vector<std::vector<size_t>>(block_count);
+  auto threads = std::vector<std::thread>{};
+  for (auto block_id = size_t{0}; block_id < block_count; ++block_id) {
+    threads.emplace_back([&, block_id]() {
+      const auto block_end = block_starts[block_id + 1];
+      auto& line_starts = line_starts_per_block[block_id];
+      line_starts.push_back(block_starts[block_id]);
+      for (auto newline = data.find('\n', block_starts[block_id]);
+           newline != std::string_view::npos && newline + 1 < block_end; newline = data.find('\n', newline + 1)) {
+        line_starts.push_back(newline + 1);
+      }
+    });
+  }
+  for (auto& thread : threads) thread.join();
+
+  auto line_starts = std::vector<size_t>{};
+  for (const auto& block_line_starts : line_starts_per_block) {
+    line_starts.insert(line_starts.end(), block_line_starts.cbegin(), block_line_starts.cend());
+  }
+  return line_starts;
+}
+
+Chunk _parse_chunk(const std::string_view data, const std::vector<size_t>& line_starts, const size_t first_row,
+                   const size_t end_row, const std::vector<std::string>& column_types, const bool compress,
+                   const char delimiter) {
+  const auto column_count = column_types.size();
+  auto builders = std::vector<std::unique_ptr<BaseColumnBuilder>>{};
+  for (const auto& column_type : column_types) {
+    builders.push_back(make_unique_by_data_type<BaseColumnBuilder, ColumnBuilder>(column_type));
+    builders.back()->reserve(end_row - first_row);
+  }
+
+  for (auto row = first_row; row < end_row; ++row) {
+    const auto line_end = row + 1 < line_starts.size() ? line_starts[row + 1] : data.size();
+    auto line = data.substr(line_starts[row], line_end - line_starts[row]);
+    line = _consume_line(line);
+
+    for (auto column_id = size_t{0}; column_id + 1 < column_count; ++column_id) {
+      const auto field_end = line.find(delimiter);
+      Assert(field_end != std::string_view::npos, "ImportCsv: Too few fields in row " + std::to_string(row));
+      builders[column_id]->append(line.substr(0, field_end));
+      line.remove_prefix(field_end + 1);
+    }
+    builders.back()->append(line);
+  }
+
+  Chunk chunk;
+  for (auto& builder : builders) {
+    chunk.add_segment(builder->build_segment(compress));
+  }
+  return chunk;
+}
+
+}  // namespace
+
+ImportCsv::ImportCsv(const std::string& file_name, const uint32_t chunk_size,
+                     const std::optional<std::string> table_name, const bool compress_chunks, const char delimiter,
+                     const ChunkPlacement placement)
+    : _file_name(file_name),
+      _chunk_size(chunk_size),
+      _table_name(table_name),
+      _compress_chunks(compress_chunks),
+      _delimiter(delimiter),
+      _placement(placement) {}
+
+std::string ImportCsv::name() const { return "ImportCsv"; }
+
+std::string ImportCsv::description() const { return name() + " " + _file_name; }
+
+std::shared_ptr<Table> ImportCsv::read_table(const std::string& file_name, const uint32_t chunk_size,
+                                             const bool compress_chunks, const char delimiter,
+                                             const ChunkPlacement placement) {
+  const MappedFile file(file_name);
+  auto data = file.view();
+
+  const auto column_names = _split_header_line(_consume_line(data), delimiter);
+  const auto column_types = _split_header_line(_consume_line(data), delimiter);
+  Assert(column_names.size() == column_types.size(), "ImportCsv: Number of column names and types does not match");
+
+  auto table = std::make_shared<Table>(chunk_size);
+  for (auto column_id = size_t{0}; column_id < column_names.size(); ++column_id) {
+    table->add_column(column_names[column_id], column_types[column_id]);
+  }
+
+  // trailing line breaks would otherwise result in empty rows
+  while (!data.empty() && (data.back() == '\n' || data.back() == '\r')) data.remove_suffix(1);
+
+  const auto worker_count = static_cast<size_t>(std::max(std::thread::hardware_concurrency(), 1u));
+  const auto line_starts = _find_line_starts(data, worker_count);
+  const auto row_count = line_starts.size();
+  const auto chunk_count = (row_count + chunk_size - 1) / chunk_size;
+
+  // every chunk is parsed by a worker on its node, so that its segments are allocated there
+  auto chunks = std::vector<Chunk>(chunk_count);
+  const auto& topology = Topology::get();
+  const auto node_of_chunk = [&](const ChunkID chunk_id) {
+    return topology.node_for_chunk(chunk_id, chunk_count, placement);
+  };
+  for_each_chunk_on_owning_node(chunk_count, node_of_chunk, [&](const ChunkID chunk_id, const NodeID worker_node_id) {
+    const auto first_row = static_cast<size_t>(chunk_id) * chunk_size;
+    const auto end_row = std::min(first_row + chunk_size, row_count);
+    chunks[chunk_id] = _parse_chunk(data, line_starts, first_row, end_row, column_types, compress_chunks, delimiter);
+    chunks[chunk_id].set_node_id(worker_node_id);
+  });
+
+  for (auto& chunk : chunks) {
+    table->emplace_chunk(std::move(chunk));
+  }
+  return table;
+}
+
+std::shared_ptr<const Table> ImportCsv::_on_execute() {
+  if (_table_name && StorageManager::get().has_table(*_table_name)) {
+    return StorageManager::get().get_table(*_table_name);
+  }
+
+  const auto table = read_table(_file_name, _chunk_size, _compress_chunks, _delimiter, _placement);
+  if (_table_name) {
+    StorageManager::get().add_table(*_table_name, table);
+  }
+  return table;
+}
+
+}  // namespace opossum
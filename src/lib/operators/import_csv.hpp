@@ -0,0 +1,55 @@
+#pragma once
+
+#include <limits>
+#include <memory>
+#include <optional>
+#include <string>
+
+#include "abstract_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Operator that loads a table from a delimiter-separated text file in the format that load_table understands, i.e.,
+ * a line of column names, a line of column types, and one line per row. By default, the delimiter is '|' as in our
+ * .tbl files; CSV files can be loaded by passing ','. Quoting is not supported.
+ *
+ * In contrast to load_table, the import is built for large files:
+ *  - the file is memory-mapped and fields are only viewed, never copied into intermediate strings
+ *  - the file is split into newline-aligned blocks whose row boundaries are determined in parallel
+ *  - every chunk is parsed by one worker directly into typed value vectors using std::from_chars
+ *  - whole chunks are added via Table::emplace_chunk and can optionally be dictionary-encoded by the worker
+ *  - chunks are assigned to the NUMA nodes of the Topology according to the ChunkPlacement and parsed by workers on
+ *    their node, so that their segments are allocated there
+ *
+ * If a table name is given, the table is added to the StorageManager. If the StorageManager already holds a table
+ * with that name, that table is returned instead.
+ */
+class ImportCsv : public AbstractOperator {
+ public:
+  ImportCsv(const std::string& file_name, const uint32_t chunk_size = std::numeric_limits<ChunkOffset>::max() - 1,
+            const std::optional<std::string> table_name = std::nullopt, const bool compress_chunks = false,
+            const char delimiter = '|', const ChunkPlacement placement = ChunkPlacement::RoundRobin);
+
+  // reads the table from the given file, can be used without an operator pipeline
+  static std::shared_ptr<Table> read_table(const std::string& file_name,
+                                           const uint32_t chunk_size = std::numeric_limits<ChunkOffset>::max() - 1,
+                                           const bool compress_chunks = false, const char delimiter = '|',
+                                           const ChunkPlacement placement = ChunkPlacement::RoundRobin);
+
+  std::string name() const override;
+  std::string description() const override;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  const std::string _file_name;
+  const uint32_t _chunk_size;
+  const std::optional<std::string> _table_name;
+  const bool _compress_chunks;
+  const char _delimiter;
+  const ChunkPlacement _placement;
+};
+
+}  // namespace opossum
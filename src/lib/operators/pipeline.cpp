@@ -0,0 +1,98 @@
+#include "pipeline.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "scheduler/chunk_workers.hpp"
+#include "scheduler/topology.hpp"
+#include "storage/chunk.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+#include "utils/hardware_counters.hpp"
+
+namespace opossum {
+
+Pipeline::Pipeline(const std::shared_ptr<const AbstractOperator>& source,
+                   std::vector<std::shared_ptr<const AbstractPipelinedOperator>> operators)
+    : AbstractOperator(source), _operators(std::move(operators)) {
+  Assert(!_operators.empty(), "a pipeline needs at least one operator");
+  auto input = source;
+  for (const auto& op : _operators) {
+    Assert(op->input_left() == input, "the operators of a pipeline have to form a chain");
+    input = op;
+  }
+}
+
+std::string Pipeline::name() const { return "Pipeline"; }
+
+std::string Pipeline::description() const {
+  auto description = name() + " [";
+  for (const auto& op : _operators) {
+    description += op->description() + (op == _operators.back() ? "]" : ", ");
+  }
+  return description;
+}
+
+std::shared_ptr<Pipeline> Pipeline::create(const std::shared_ptr<const AbstractOperator>& last_operator) {
+  auto operators = std::vector<std::shared_ptr<const AbstractPipelinedOperator>>{};
+  auto source = last_operator;
+  while (const auto op = std::dynamic_pointer_cast<const AbstractPipelinedOperator>(source)) {
+    operators.push_back(op);
+    source = op->input_left();
+  }
+  std::reverse(operators.begin(), operators.end());
+  return std::make_shared<Pipeline>(source, std::move(operators));
+}
+
+const std::vector<std::shared_ptr<const AbstractPipelinedOperator>>& Pipeline::operators() const {
+  return _operators;
+}
+
+std::shared_ptr<const Table> Pipeline::_on_execute() {
+  const auto source_table = _input_table_left();
+
+  // the column definitions of the input of every operator, only the first one actually contains chunks
+  auto input_tables = std::vector<std::shared_ptr<const Table>>{source_table};
+  auto output_table = std::shared_ptr<Table>{};
+  for (const auto& op : _operators) {
+    op->prepare(*input_tables.back());
+    output_table = op->create_output_table(*input_tables.back());
+    input_tables.push_back(output_table);
+  }
+
+  const auto chunk_count = source_table->chunk_count();
+  const auto& topology = Topology::get();
+  const auto node_of_chunk = [&](const ChunkID chunk_id) {
+    const auto node_id = source_table->get_chunk(chunk_id).node_id();
+    return node_id != UNKNOWN_NODE_ID ? node_id
+                                      : topology.node_for_chunk(chunk_id, chunk_count, ChunkPlacement::RoundRobin);
+  };
+
+  auto output_chunks = std::vector<std::optional<Chunk>>(chunk_count);
+  for_each_chunk_on_owning_node(chunk_count, node_of_chunk, [&](const ChunkID chunk_id, const NodeID) {
+    // the workers are not covered by the hardware counters of the calling thread, so they are measured separately
+    const auto hardware_counters_before = HardwareCounters::read();
+    auto chunk = _operators.front()->execute_on_chunk(source_table, chunk_id, source_table->get_chunk(chunk_id));
+    for (auto operator_index = size_t{1}; chunk && operator_index < _operators.size(); ++operator_index) {
+      chunk = _operators[operator_index]->execute_on_chunk(input_tables[operator_index], chunk_id, *chunk);
+    }
+    output_chunks[chunk_id] = std::move(chunk);
+    _register_hardware_counters(HardwareCounters::read() - hardware_counters_before);
+  });
+
+  for (auto& chunk : output_chunks) {
+    if (chunk) output_table->emplace_chunk(std::move(*chunk));
+  }
+
+  // the chunks that the operators pruned and their kernels are reported as those of the pipeline
+  for (const auto& op : _operators) {
+    _pruned_chunk_count += op->pruned_chunk_count();
+    _register_kernel_hardware_counters(op->kernel_hardware_counters());
+  }
+  return output_table;
+}
+
+}  // namespace opossum
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "abstract_operator.hpp"
+#include "abstract_pipelined_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+
+// A Pipeline executes a chain of pipelined operators (e.g., several TableScans) morsel by morsel: every chunk of the
+// source's output passes through all operators on one worker thread before the worker takes the next chunk. The
+// intermediate chunks therefore stay in the cache, and the operators do not materialize intermediate tables. The
+// source is a pipeline breaker, i.e., an operator that has to be executed completely beforehand.
+//
+// The chunks are processed in parallel by one set of workers per node of the Topology, each preferring the chunks that
+// are placed on its node (see for_each_chunk_on_owning_node). The output keeps the order of the source's chunks.
+//
+// The operators of the pipeline are not executed themselves, i.e., their get_output remains nullptr.
+class Pipeline : public AbstractOperator {
+ public:
+  // the first operator must have the source as its input, every following operator its predecessor
+  Pipeline(const std::shared_ptr<const AbstractOperator>& source,
+           std::vector<std::shared_ptr<const AbstractPipelinedOperator>> operators);
+
+  // creates a pipeline of the pipelined operators that lead up to the given operator, starting behind the first
+  // operator that is not pipelined
+  static std::shared_ptr<Pipeline> create(const std::shared_ptr<const AbstractOperator>& last_operator);
+
+  const std::vector<std::shared_ptr<const AbstractPipelinedOperator>>& operators() const;
+
+  std::string name() const override;
+  std::string description() const override;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  const std::vector<std::shared_ptr<const AbstractPipelinedOperator>> _operators;
+};
+
+}  // namespace opossum
@@ -0,0 +1,200 @@
+#include "plan_cache.hpp"
+
+#include <memory>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "get_table.hpp"
+#include "pipeline.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "table_wrapper.hpp"
+#include "utils/assert.hpp"
+#include "utils/metrics.hpp"
+
+namespace opossum {
+
+PreparedPlan::PreparedPlan(const std::shared_ptr<const AbstractOperator>& root)
+    : _catalog_version(StorageManager::get().catalog_version()) {
+  auto prepared_operators =
+      std::unordered_map<const AbstractOperator*, std::pair<size_t, std::shared_ptr<const Table>>>{};
+  auto output_table = std::shared_ptr<const Table>{};
+  _add_nodes(root, prepared_operators, output_table);
+}
+
+size_t PreparedPlan::_add_nodes(
+    const std::shared_ptr<const AbstractOperator>& op,
+    std::unordered_map<const AbstractOperator*, std::pair<size_t, std::shared_ptr<const Table>>>& prepared_operators,
+    std::shared_ptr<const Table>& output_table) {
+  const auto prepared_operator = prepared_operators.find(op.get());
+  if (prepared_operator != prepared_operators.cend()) {
+    output_table = prepared_operator->second.second;
+    return prepared_operator->second.first;
+  }
+
+  auto node = Node{};
+  if (const auto get_table = std::dynamic_pointer_cast<const GetTable>(op)) {
+    node.type = NodeType::GetTable;
+    node.table_name = get_table->table_name();
+    node.table = StorageManager::get().get_table(node.table_name);
+    output_table = node.table;
+  } else if (const auto table_wrapper = std::dynamic_pointer_cast<const TableWrapper>(op)) {
+    node.type = NodeType::TableWrapper;
+    node.table = table_wrapper->table();
+    output_table = node.table;
+  } else if (const auto table_scan = std::dynamic_pointer_cast<const TableScan>(op)) {
+    node.type = NodeType::TableScan;
+    node.input_index = _add_nodes(table_scan->input_left(), prepared_operators, output_table);
+    node.column_id = table_scan->column_id();
+    node.scan_type = table_scan->scan_type();
+    node.parameter_index = _default_parameters.size();
+    _default_parameters.push_back(table_scan->search_value());
+    // scans keep the columns of their input
+    node.scan_impl = TableScan::_create_impl(output_table->column_type(node.column_id));
+  } else if (const auto pipeline = std::dynamic_pointer_cast<const Pipeline>(op)) {
+    node.type = NodeType::Pipeline;
+    node.input_index = _add_nodes(pipeline->operators().back(), prepared_operators, output_table);
+    for (auto index = node.input_index; _nodes[index].type == NodeType::TableScan; index = _nodes[index].input_index) {
+      _nodes[index].is_pipelined = true;
+    }
+  } else {
+    Fail("operator cannot be prepared: " + op->name());
+  }
+
+  _nodes.push_back(std::move(node));
+  prepared_operators.emplace(op.get(), std::make_pair(_nodes.size() - 1, output_table));
+  return _nodes.size() - 1;
+}
+
+std::string PreparedPlan::shape_key(const AbstractOperator& root) {
+  if (const auto get_table = dynamic_cast<const GetTable*>(&root)) {
+    return "GetTable(" + get_table->table_name() + ")";
+  }
+  if (const auto table_wrapper = dynamic_cast<const TableWrapper*>(&root)) {
+    // wrapped tables have no name, so they are identified by their address
+    auto stream = std::ostringstream{};
+    stream << "TableWrapper(" << table_wrapper->table().get() << ")";
+    return stream.str();
+  }
+  if (const auto table_scan = dynamic_cast<const TableScan*>(&root)) {
+    return "TableScan(" + std::to_string(table_scan->column_id()) + " " +
+           std::to_string(static_cast<int>(table_scan->scan_type())) + ", " + shape_key(*table_scan->input_left()) +
+           ")";
+  }
+  if (const auto pipeline = dynamic_cast<const Pipeline*>(&root)) {
+    return "Pipeline(" + shape_key(*pipeline->operators().back()) + ")";
+  }
+  Fail("operator cannot be prepared: " + root.name());
+  return "";
+}
+
+size_t PreparedPlan::parameter_count() const { return _default_parameters.size(); }
+
+const std::vector<AllTypeVariant>& PreparedPlan::default_parameters() const { return _default_parameters; }
+
+bool PreparedPlan::is_valid() const { return StorageManager::get().catalog_version() == _catalog_version; }
+
+std::vector<std::shared_ptr<AbstractOperator>> PreparedPlan::instantiate(
+    const std::vector<AllTypeVariant>& parameters) const {
+  Assert(parameters.size() == parameter_count(), "the plan has " + std::to_string(parameter_count()) +
+                                                     " parameters, but " + std::to_string(parameters.size()) +
+                                                     " were given");
+  const auto is_plan_valid = is_valid();
+
+  auto operators = std::vector<std::shared_ptr<AbstractOperator>>{};
+  operators.reserve(_nodes.size());
+  for (const auto& node : _nodes) {
+    switch (node.type) {
+      case NodeType::GetTable:
+        operators.push_back(is_plan_valid ? std::make_shared<GetTable>(node.table_name, node.table)
+                                          : std::make_shared<GetTable>(node.table_name));
+        break;
+      case NodeType::TableWrapper:
+        operators.push_back(std::make_shared<TableWrapper>(node.table));
+        break;
+      case NodeType::TableScan:
+        operators.push_back(std::shared_ptr<TableScan>(
+            new TableScan(operators[node.input_index], node.column_id, node.scan_type,
+                          parameters[node.parameter_index], is_plan_valid ? node.scan_impl : nullptr)));
+        break;
+      case NodeType::Pipeline:
+        operators.push_back(Pipeline::create(operators[node.input_index]));
+        break;
+    }
+  }
+
+  auto executed_operators = std::vector<std::shared_ptr<AbstractOperator>>{};
+  executed_operators.reserve(operators.size());
+  for (auto node_index = size_t{0}; node_index < _nodes.size(); ++node_index) {
+    if (!_nodes[node_index].is_pipelined) executed_operators.push_back(std::move(operators[node_index]));
+  }
+  return executed_operators;
+}
+
+PlanCache::PlanCache(const size_t capacity) : _capacity(capacity) {}
+
+std::shared_ptr<const PreparedPlan> PlanCache::get(const std::string& key) {
+  static auto& hits = MetricsRegistry::get().counter("opossum_plan_cache_hits_total", "Lookups of cached plans");
+  static auto& misses =
+      MetricsRegistry::get().counter("opossum_plan_cache_misses_total", "Lookups of plans that were not cached");
+
+  std::lock_guard lock(_mutex);
+  const auto entry = _entries_by_key.find(key);
+  if (entry == _entries_by_key.cend()) {
+    misses.increment();
+    return nullptr;
+  }
+  if (!entry->second->second->is_valid()) {
+    _entries.erase(entry->second);
+    _entries_by_key.erase(entry);
+    misses.increment();
+    return nullptr;
+  }
+
+  hits.increment();
+  _entries.splice(_entries.begin(), _entries, entry->second);
+  return entry->second->second;
+}
+
+void PlanCache::set(const std::string& key, std::shared_ptr<const PreparedPlan> plan) {
+  std::lock_guard lock(_mutex);
+  const auto entry = _entries_by_key.find(key);
+  if (entry != _entries_by_key.cend()) {
+    entry->second->second = std::move(plan);
+    _entries.splice(_entries.begin(), _entries, entry->second);
+    return;
+  }
+
+  _entries.emplace_front(key, std::move(plan));
+  _entries_by_key.emplace(key, _entries.begin());
+  if (_entries.size() > _capacity) {
+    _entries_by_key.erase(_entries.back().first);
+    _entries.pop_back();
+  }
+}
+
+std::shared_ptr<const PreparedPlan> PlanCache::get_or_prepare(const std::shared_ptr<const AbstractOperator>& root) {
+  const auto key = PreparedPlan::shape_key(*root);
+  auto plan = get(key);
+  if (!plan) {
+    plan = std::make_shared<const PreparedPlan>(root);
+    set(key, plan);
+  }
+  return plan;
+}
+
+size_t PlanCache::size() const {
+  std::lock_guard lock(_mutex);
+  return _entries.size();
+}
+
+void PlanCache::clear() {
+  std::lock_guard lock(_mutex);
+  _entries.clear();
+  _entries_by_key.clear();
+}
+
+}  // namespace opossum
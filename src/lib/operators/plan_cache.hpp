@@ -0,0 +1,115 @@
+#pragma once
+
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "abstract_operator.hpp"
+#include "all_type_variant.hpp"
+#include "table_scan.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+
+/**
+ * A PreparedPlan stores the shape of a plan, i.e., its operators without their outputs, so that the plan can be
+ * executed repeatedly with different search values. The search values of the TableScans become parameters, numbered in
+ * the order in which the scans are executed, i.e., inputs before their consumers.
+ *
+ * Everything that does not depend on the parameters is resolved once: the tables of GetTable operators are looked up
+ * in the StorageManager, and the scan implementations are resolved for the types of the scanned columns. If tables
+ * are added, dropped or restored afterwards, the plan is outdated (see is_valid) and its instances look up the tables
+ * and resolve the scans again, just like freshly created operators.
+ *
+ * Plans may consist of GetTable, TableWrapper, TableScan and Pipeline operators. Operators that are the input of
+ * several operators are shared in the instances as well.
+ */
+class PreparedPlan {
+ public:
+  explicit PreparedPlan(const std::shared_ptr<const AbstractOperator>& root);
+
+  // returns a key that is equal for plans with the same operators and inputs, but possibly different search values
+  static std::string shape_key(const AbstractOperator& root);
+
+  size_t parameter_count() const;
+
+  // returns the search values of the plan from which the PreparedPlan was created
+  const std::vector<AllTypeVariant>& default_parameters() const;
+
+  // returns whether the tables of the StorageManager are unchanged since the plan was prepared
+  bool is_valid() const;
+
+  // Creates the operators of the plan with the given search values. Returns the operators that have to be executed in
+  // the order of execution, i.e., all except those within a Pipeline. The root of the plan is the last one.
+  std::vector<std::shared_ptr<AbstractOperator>> instantiate(const std::vector<AllTypeVariant>& parameters) const;
+
+ protected:
+  enum class NodeType { GetTable, TableWrapper, TableScan, Pipeline };
+
+  struct Node {
+    NodeType type;
+    // the node of the input, or of the last operator for a Pipeline
+    size_t input_index = 0;
+
+    // GetTable and TableWrapper
+    std::string table_name;
+    std::shared_ptr<const Table> table;
+
+    // TableScan
+    ColumnID column_id{0};
+    ScanType scan_type = ScanType::OpEquals;
+    size_t parameter_index = 0;
+    std::shared_ptr<TableScan::BaseTableScanImpl> scan_impl;
+    // scans within a Pipeline are not executed themselves
+    bool is_pipelined = false;
+  };
+
+  // adds the nodes of the operator and its inputs, returns the index of the operator's node and sets output_table to a
+  // table with the columns of its output
+  size_t _add_nodes(const std::shared_ptr<const AbstractOperator>& op,
+                    std::unordered_map<const AbstractOperator*, std::pair<size_t, std::shared_ptr<const Table>>>&
+                        prepared_operators,
+                    std::shared_ptr<const Table>& output_table);
+
+  // the nodes in the order of execution, the root is the last one
+  std::vector<Node> _nodes;
+  std::vector<AllTypeVariant> _default_parameters;
+  uint64_t _catalog_version;
+};
+
+// Caches PreparedPlans by a key, e.g., the shape key of the plan or the name of a query, and evicts the least recently
+// used plan once the capacity is exceeded. Outdated plans are treated as missing. The cache is thread-safe.
+class PlanCache : private Noncopyable {
+ public:
+  static constexpr size_t DEFAULT_CAPACITY = 1024;
+
+  explicit PlanCache(size_t capacity = DEFAULT_CAPACITY);
+
+  // returns the cached plan, or nullptr if there is no valid plan for the key
+  std::shared_ptr<const PreparedPlan> get(const std::string& key);
+
+  void set(const std::string& key, std::shared_ptr<const PreparedPlan> plan);
+
+  // returns the cached plan for the shape of the given plan, which is prepared and cached if there is none
+  std::shared_ptr<const PreparedPlan> get_or_prepare(const std::shared_ptr<const AbstractOperator>& root);
+
+  size_t size() const;
+  void clear();
+
+ protected:
+  using Entry = std::pair<std::string, std::shared_ptr<const PreparedPlan>>;
+
+  const size_t _capacity;
+  // the entries from the most to the least recently used one
+  std::list<Entry> _entries;
+  std::unordered_map<std::string, std::list<Entry>::iterator> _entries_by_key;
+  mutable std::mutex _mutex;
+};
+
+}  // namespace opossum
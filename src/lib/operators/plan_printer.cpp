@@ -0,0 +1,170 @@
+#include "plan_printer.hpp"
+
+#include <chrono>
+#include <iomanip>
+#include <map>
+#include <memory>
+#include <set>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace opossum {
+
+namespace {
+
+std::string format_duration(const std::chrono::nanoseconds duration) {
+  auto stream = std::ostringstream{};
+  stream << std::fixed << std::setprecision(1);
+  const auto nanoseconds = static_cast<double>(duration.count());
+  if (nanoseconds < 1e3) {
+    stream << nanoseconds << " ns";
+  } else if (nanoseconds < 1e6) {
+    stream << nanoseconds / 1e3 << " us";
+  } else if (nanoseconds < 1e9) {
+    stream << nanoseconds / 1e6 << " ms";
+  } else {
+    stream << nanoseconds / 1e9 << " s";
+  }
+  return stream.str();
+}
+
+std::string format_bytes(const size_t bytes) {
+  auto stream = std::ostringstream{};
+  if (bytes < 1024) {
+    stream << bytes << " B";
+    return stream.str();
+  }
+  stream << std::fixed << std::setprecision(1);
+  auto value = static_cast<double>(bytes) / 1024.0;
+  for (const auto unit : {"KiB", "MiB", "GiB"}) {
+    if (value < 1024.0 || unit == std::string{"GiB"}) {
+      stream << value << " " << unit;
+      break;
+    }
+    value /= 1024.0;
+  }
+  return stream.str();
+}
+
+// formats large event counts with a metric prefix, e.g., 1.5M
+std::string format_count(const uint64_t count) {
+  auto stream = std::ostringstream{};
+  if (count < 1000) {
+    stream << count;
+    return stream.str();
+  }
+  stream << std::fixed << std::setprecision(1);
+  auto value = static_cast<double>(count) / 1000.0;
+  for (const auto prefix : {"k", "M", "G", "T"}) {
+    if (value < 1000.0 || prefix == std::string{"T"}) {
+      stream << value << prefix;
+      break;
+    }
+    value /= 1000.0;
+  }
+  return stream.str();
+}
+
+std::string format_hardware_counters(const HardwareCounterValues& values) {
+  return format_count(values.cycles) + " cycles, " + format_count(values.instructions) + " instructions, " +
+         format_count(values.llc_misses) + " LLC misses, " + format_count(values.branch_misses) + " branch misses";
+}
+
+std::vector<std::shared_ptr<const AbstractOperator>> inputs(const AbstractOperator& op) {
+  auto inputs = std::vector<std::shared_ptr<const AbstractOperator>>{};
+  if (op.input_left()) inputs.push_back(op.input_left());
+  if (op.input_right()) inputs.push_back(op.input_right());
+  return inputs;
+}
+
+// An operator can be the input of several operators. Its subtree is only printed below its first consumer.
+void print_text_node(const std::shared_ptr<const AbstractOperator>& op, const std::string& prefix, const bool is_root,
+                     const bool is_last_input, std::set<const AbstractOperator*>& printed_operators,
+                     std::ostream& out) {
+  out << prefix << (is_root ? "" : (is_last_input ? "`- " : "|- ")) << op->description();
+  if (!printed_operators.insert(op.get()).second) {
+    out << " (see above)\n";
+    return;
+  }
+  out << " (" << PlanPrinter::format_performance_data(op->performance_data()) << ")\n";
+
+  const auto input_prefix = prefix + (is_root ? "" : (is_last_input ? "   " : "|  "));
+  const auto operator_inputs = inputs(*op);
+  for (auto input_index = size_t{0}; input_index < operator_inputs.size(); ++input_index) {
+    print_text_node(operator_inputs[input_index], input_prefix, false, input_index + 1 == operator_inputs.size(),
+                    printed_operators, out);
+  }
+}
+
+std::string escape_dot_label(const std::string& label) {
+  auto escaped = std::string{};
+  for (const auto character : label) {
+    if (character == '"' || character == '\\') escaped += '\\';
+    escaped += character;
+  }
+  return escaped;
+}
+
+// prints the node of the operator and the edges from its inputs, and returns the id of the node
+size_t print_dot_node(const std::shared_ptr<const AbstractOperator>& op,
+                      std::map<const AbstractOperator*, size_t>& node_ids, std::ostream& out) {
+  const auto node_id_iter = node_ids.find(op.get());
+  if (node_id_iter != node_ids.end()) return node_id_iter->second;
+
+  const auto node_id = node_ids.size();
+  node_ids.emplace(op.get(), node_id);
+  out << "  operator_" << node_id << " [label=\"" << escape_dot_label(op->description()) << "\\n"
+      << escape_dot_label(PlanPrinter::format_performance_data(op->performance_data())) << "\"];\n";
+
+  for (const auto& input : inputs(*op)) {
+    const auto input_node_id = print_dot_node(input, node_ids, out);
+    out << "  operator_" << input_node_id << " -> operator_" << node_id;
+    if (input->performance_data().executed) {
+      out << " [label=\"" << input->performance_data().output_row_count << " rows\"]";
+    }
+    out << ";\n";
+  }
+  return node_id;
+}
+
+}  // namespace
+
+void PlanPrinter::print_text(const std::shared_ptr<const AbstractOperator>& root, std::ostream& out) {
+  auto printed_operators = std::set<const AbstractOperator*>{};
+  print_text_node(root, "", true, true, printed_operators, out);
+}
+
+void PlanPrinter::print_dot(const std::shared_ptr<const AbstractOperator>& root, std::ostream& out) {
+  auto node_ids = std::map<const AbstractOperator*, size_t>{};
+  out << "digraph {\n  rankdir=BT;\n  node [shape=box, fontname=\"Helvetica\"];\n";
+  print_dot_node(root, node_ids, out);
+  out << "}\n";
+}
+
+std::string PlanPrinter::format_performance_data(const OperatorPerformanceData& performance_data) {
+  if (!performance_data.executed) return "not executed";
+
+  auto stream = std::ostringstream{};
+  stream << format_duration(performance_data.walltime) << " wall, " << format_duration(performance_data.cpu_time)
+         << " CPU, ";
+  // executed inputs have at least one chunk
+  if (performance_data.input_chunk_count > 0) {
+    stream << "in: " << performance_data.input_row_count << " rows / " << performance_data.input_chunk_count
+           << " chunks, ";
+  }
+  stream << "out: " << performance_data.output_row_count << " rows / " << performance_data.output_chunk_count
+         << " chunks, " << format_bytes(performance_data.allocated_bytes) << " allocated";
+  if (performance_data.pruned_chunk_count > 0) {
+    stream << ", " << performance_data.pruned_chunk_count << " chunks pruned";
+  }
+  if (performance_data.hardware_counters.available) {
+    stream << ", counters: " << format_hardware_counters(performance_data.hardware_counters);
+  }
+  if (performance_data.kernel_hardware_counters.available) {
+    stream << ", in kernels: " << format_hardware_counters(performance_data.kernel_hardware_counters);
+  }
+  return stream.str();
+}
+
+}  // namespace opossum
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <iostream>
+#include <memory>
+#include <string>
+
+#include "abstract_operator.hpp"
+
+namespace opossum {
+
+/**
+ * Renders a plan, i.e., an operator and all operators that it transitively consumes via input_left() and
+ * input_right(), together with the performance data of every operator, similar to EXPLAIN ANALYZE. Operators that have
+ * not been executed are marked as such.
+ *
+ * The text format prints one operator per line, indented below its consumer:
+ *
+ *   TableScan a < 5 (1.2 ms wall, 1.1 ms CPU, in: 1000 rows / 10 chunks, out: 12 rows / 3 chunks, 1.5 KiB allocated)
+ *   `- GetTable table_a (1.0 us wall, ...)
+ *
+ * If hardware counters are enabled (see HardwareCounters), the counters of the operators and of their scan kernels are
+ * appended, e.g., "counters: 2.1M cycles, 3.5M instructions, 12.0k LLC misses, 1.2k branch misses".
+ *
+ * The DOT format can be rendered with Graphviz, e.g., dot -Tsvg plan.dot > plan.svg. Its edges point from an input to
+ * its consumer and are labeled with the number of rows that pass along them.
+ */
+class PlanPrinter {
+ public:
+  static void print_text(const std::shared_ptr<const AbstractOperator>& root, std::ostream& out = std::cout);
+  static void print_dot(const std::shared_ptr<const AbstractOperator>& root, std::ostream& out = std::cout);
+
+  // returns the performance data of an operator as shown in the reports, e.g., "1.2 ms wall, 1.1 ms CPU, ..."
+  static std::string format_performance_data(const OperatorPerformanceData& performance_data);
+};
+
+}  // namespace opossum
@@ -17,6 +17,8 @@ namespace opossum {
 
 Print::Print(const std::shared_ptr<const AbstractOperator> in, std::ostream& out) : AbstractOperator(in), _out(out) {}
 
+std::string Print::name() const { return "Print"; }
+
 void Print::print(std::shared_ptr<const Table> table, std::ostream& out) {
   auto table_wrapper = std::make_shared<TableWrapper>(table);
   table_wrapper->execute();
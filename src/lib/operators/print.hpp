@@ -18,6 +18,8 @@ class Print : public AbstractOperator {
 
   static void print(std::shared_ptr<const Table> table, std::ostream& out = std::cout);
 
+  std::string name() const override;
+
  protected:
   std::vector<uint16_t> column_string_widths(uint16_t min, uint16_t max, std::shared_ptr<const Table> t) const;
   std::shared_ptr<const Table> _on_execute() override;
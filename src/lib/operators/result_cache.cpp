@@ -0,0 +1,198 @@
+#include "result_cache.hpp"
+
+#include <array>
+#include <charconv>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "get_table.hpp"
+#include "pipeline.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "table_scan.hpp"
+#include "table_wrapper.hpp"
+#include "utils/assert.hpp"
+#include "utils/metrics.hpp"
+#include "utils/query_arena.hpp"
+
+namespace opossum {
+
+namespace {
+
+// adds a table that is read by the plan to its key, tables are identified by their address as long as they exist
+void append_table_key(const std::shared_ptr<const Table>& table, std::string& key) {
+  auto stream = std::ostringstream{};
+  stream << table.get();
+  key += stream.str();
+}
+
+// encodes the search value losslessly, unlike the conversion to strings, which rounds floating-point numbers
+std::string search_value_key(const AllTypeVariant& search_value) {
+  return boost::apply_visitor(
+      [](const auto& value) -> std::string {
+        using Type = std::decay_t<decltype(value)>;
+        if constexpr (std::is_same_v<Type, std::string>) {
+          return value;
+        } else if constexpr (std::is_floating_point_v<Type>) {
+          // the shortest representation that is parsed as the same value
+          auto buffer = std::array<char, 64>{};
+          const auto result = std::to_chars(buffer.data(), buffer.data() + buffer.size(), value);
+          return std::string(buffer.data(), result.ptr);
+        } else {
+          return std::to_string(value);
+        }
+      },
+      search_value);
+}
+
+}  // namespace
+
+ResultCache::ResultCache(const size_t memory_budget) : _memory_budget(memory_budget) {}
+
+bool ResultCache::_append_key(const AbstractOperator& op, std::string& key, std::vector<TableVersion>& table_versions) {
+  if (const auto get_table = dynamic_cast<const GetTable*>(&op)) {
+    if (!StorageManager::get().has_table(get_table->table_name())) return false;
+    const auto table = StorageManager::get().get_table(get_table->table_name());
+    key += "GetTable(";
+    append_table_key(table, key);
+    key += ")";
+    table_versions.push_back(TableVersion{table, table->version()});
+    return true;
+  }
+  if (const auto table_wrapper = dynamic_cast<const TableWrapper*>(&op)) {
+    key += "TableWrapper(";
+    append_table_key(table_wrapper->table(), key);
+    key += ")";
+    table_versions.push_back(TableVersion{table_wrapper->table(), table_wrapper->table()->version()});
+    return true;
+  }
+  if (const auto table_scan = dynamic_cast<const TableScan*>(&op)) {
+    // the type and the length of the search value keep the keys of different values apart
+    const auto search_value = search_value_key(table_scan->search_value());
+    key += "TableScan(" + std::to_string(table_scan->column_id()) + " " +
+           std::to_string(static_cast<int>(table_scan->scan_type())) + " " +
+           std::to_string(table_scan->search_value().which()) + " " + std::to_string(search_value.size()) + ":" +
+           search_value + ", ";
+    if (!_append_key(*table_scan->input_left(), key, table_versions)) return false;
+    key += ")";
+    return true;
+  }
+  if (const auto pipeline = dynamic_cast<const Pipeline*>(&op)) {
+    key += "Pipeline(";
+    if (!_append_key(*pipeline->operators().back(), key, table_versions)) return false;
+    key += ")";
+    return true;
+  }
+  return false;
+}
+
+bool ResultCache::_create_key(const AbstractOperator& root, std::string& key,
+                              std::vector<TableVersion>& table_versions) {
+  if (dynamic_cast<const GetTable*>(&root) || dynamic_cast<const TableWrapper*>(&root)) return false;
+  return _append_key(root, key, table_versions);
+}
+
+bool ResultCache::is_cacheable(const AbstractOperator& root) {
+  auto key = std::string{};
+  auto table_versions = std::vector<TableVersion>{};
+  return _create_key(root, key, table_versions);
+}
+
+bool ResultCache::_is_valid(const Entry& entry) {
+  for (const auto& table_version : entry.table_versions) {
+    const auto table = table_version.table.lock();
+    if (!table || table->version() != table_version.version) return false;
+  }
+  return true;
+}
+
+void ResultCache::_erase(const std::list<Entry>::iterator entry) {
+  _memory_usage -= entry->memory_usage;
+  _entries_by_key.erase(entry->key);
+  _entries.erase(entry);
+}
+
+std::shared_ptr<const Table> ResultCache::get(const AbstractOperator& root) {
+  auto key = std::string{};
+  auto table_versions = std::vector<TableVersion>{};
+  if (!_create_key(root, key, table_versions)) return nullptr;
+  return _get(key);
+}
+
+std::shared_ptr<const Table> ResultCache::_get(const std::string& key) {
+  static auto& hits = MetricsRegistry::get().counter("opossum_result_cache_hits_total", "Lookups of cached results");
+  static auto& misses =
+      MetricsRegistry::get().counter("opossum_result_cache_misses_total", "Lookups of results that were not cached");
+
+  std::lock_guard lock(_mutex);
+  const auto entry = _entries_by_key.find(key);
+  if (entry == _entries_by_key.cend()) {
+    misses.increment();
+    return nullptr;
+  }
+  if (!_is_valid(*entry->second)) {
+    _erase(entry->second);
+    misses.increment();
+    return nullptr;
+  }
+
+  hits.increment();
+  _entries.splice(_entries.begin(), _entries, entry->second);
+  return _entries.front().result;
+}
+
+std::shared_ptr<const Table> ResultCache::execute(const std::vector<std::shared_ptr<AbstractOperator>>& plan) {
+  DebugAssert(!plan.empty(), "the plan must contain an operator");
+  const auto& root = *plan.back();
+  auto key = std::string{};
+  auto table_versions = std::vector<TableVersion>{};
+  // results that are allocated from an arena must not outlive it
+  const auto cacheable = !QueryArena::is_active() && _create_key(root, key, table_versions);
+  if (cacheable) {
+    if (const auto result = _get(key)) return result;
+  }
+
+  for (const auto& op : plan) {
+    op->execute();
+  }
+  const auto result = root.get_output();
+  if (!cacheable) return result;
+
+  const auto memory_usage = result->estimate_memory_usage();
+  if (memory_usage > _memory_budget) return result;
+
+  std::lock_guard lock(_mutex);
+  const auto entry = _entries_by_key.find(key);
+  if (entry != _entries_by_key.cend()) _erase(entry->second);
+
+  _entries.push_front(Entry{key, result, memory_usage, std::move(table_versions)});
+  _entries_by_key.emplace(std::move(key), _entries.begin());
+  _memory_usage += memory_usage;
+  while (_memory_usage > _memory_budget) {
+    _erase(std::prev(_entries.end()));
+  }
+  return result;
+}
+
+size_t ResultCache::size() const {
+  std::lock_guard lock(_mutex);
+  return _entries.size();
+}
+
+size_t ResultCache::memory_usage() const {
+  std::lock_guard lock(_mutex);
+  return _memory_usage;
+}
+
+void ResultCache::clear() {
+  std::lock_guard lock(_mutex);
+  _entries.clear();
+  _entries_by_key.clear();
+  _memory_usage = 0;
+}
+
+}  // namespace opossum
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "abstract_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+
+/**
+ * The ResultCache stores the outputs of deterministic plans, so that repeatedly executed plans, e.g., the filters of a
+ * dashboard, are answered without scanning the tables again as long as the tables do not change.
+ *
+ * A result is keyed by the operators of its plan and their parameters, e.g., the search values of the TableScans, and
+ * the identities of the tables that the plan reads. Along with the result, the cache stores the versions of these
+ * tables (see Table::version). Once a table is changed, its results are outdated and are dropped on their next lookup.
+ *
+ * Plans may consist of GetTable, TableWrapper, TableScan and Pipeline operators. The results are accounted with their
+ * estimated memory usage, and the least recently used results are evicted once the memory budget is exceeded. As the
+ * outputs of TableScans mostly reference their input tables, this counts the position lists rather than the values.
+ *
+ * Results of plans that are executed while a QueryArena is active are not cached, because they are freed with the
+ * arena.
+ */
+class ResultCache : private Noncopyable {
+ public:
+  static constexpr size_t DEFAULT_MEMORY_BUDGET = 256 * 1024 * 1024;
+
+  explicit ResultCache(size_t memory_budget = DEFAULT_MEMORY_BUDGET);
+
+  // returns whether the result of the plan can be cached, i.e., whether it consists of supported operators only and
+  // does not simply return a table
+  static bool is_cacheable(const AbstractOperator& root);
+
+  // returns the cached result of the plan, or nullptr if there is no result for the current versions of its tables
+  std::shared_ptr<const Table> get(const AbstractOperator& root);
+
+  // Returns the result of the plan, whose operators are given in the order of execution with the root as the last one
+  // (e.g., from PreparedPlan::instantiate). If the result is not cached, the operators are executed and the result is
+  // cached if possible. The versions of the tables are taken before the execution, so that the result is outdated if
+  // a table is changed concurrently.
+  std::shared_ptr<const Table> execute(const std::vector<std::shared_ptr<AbstractOperator>>& plan);
+
+  size_t size() const;
+
+  // returns the estimated memory usage of the cached results
+  size_t memory_usage() const;
+
+  void clear();
+
+ protected:
+  // a table read by a plan, with its version when the result was computed
+  struct TableVersion {
+    std::weak_ptr<const Table> table;
+    uint64_t version;
+  };
+
+  struct Entry {
+    std::string key;
+    std::shared_ptr<const Table> result;
+    size_t memory_usage;
+    std::vector<TableVersion> table_versions;
+  };
+
+  // appends the key of the plan and returns false if it contains unsupported operators
+  static bool _append_key(const AbstractOperator& op, std::string& key, std::vector<TableVersion>& table_versions);
+
+  // creates the key of the plan and returns whether its result can be cached (see is_cacheable)
+  static bool _create_key(const AbstractOperator& root, std::string& key, std::vector<TableVersion>& table_versions);
+
+  static bool _is_valid(const Entry& entry);
+
+  std::shared_ptr<const Table> _get(const std::string& key);
+
+  void _erase(std::list<Entry>::iterator entry);
+
+  const size_t _memory_budget;
+  size_t _memory_usage = 0;
+  // the entries from the most to the least recently used one
+  std::list<Entry> _entries;
+  std::unordered_map<std::string, std::list<Entry>::iterator> _entries_by_key;
+  mutable std::mutex _mutex;
+};
+
+}  // namespace opossum
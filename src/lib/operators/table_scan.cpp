@@ -1,28 +1,191 @@
 #include "table_scan.hpp"
 
+#include <map>
 #include <memory>
+#include <sstream>
 #include <string>
+#include <utility>
 
 #include "../resolve_type.hpp"
+#include "../storage/selection_bitmap.hpp"
 #include "../storage/table.hpp"
 
 namespace opossum {
 
+namespace {
+
+// the rows of a single chunk that a ReferenceSegment references, either as chunk offsets or as selection bitmap
+struct ReferencedRows {
+  ChunkID chunk_id = INVALID_CHUNK_ID;
+  std::shared_ptr<const ChunkOffsetList> chunk_offsets;
+  std::shared_ptr<const SelectionBitmap> selection_bitmap;
+};
+
+// keeps the selection bitmap if it needs less memory than the offsets of the selected rows
+ReferencedRows compact_rows(const ChunkID chunk_id, const std::shared_ptr<const SelectionBitmap>& selection_bitmap) {
+  if (SelectionBitmap::is_smaller_than_chunk_offsets(selection_bitmap->size(), selection_bitmap->chunk_size())) {
+    return ReferencedRows{chunk_id, nullptr, selection_bitmap};
+  }
+  const auto allocator = PolymorphicAllocator<ChunkOffsetList>{selection_bitmap->words().get_allocator().resource()};
+  auto chunk_offsets = std::allocate_shared<ChunkOffsetList>(allocator, selection_bitmap->to_chunk_offsets());
+  return ReferencedRows{chunk_id, std::move(chunk_offsets), nullptr};
+}
+
+std::shared_ptr<ReferenceSegment> create_reference_segment(const std::shared_ptr<const Table>& referenced_table,
+                                                           const ColumnID referenced_column_id,
+                                                           const ReferencedRows& rows) {
+  if (rows.chunk_offsets) {
+    return std::make_shared<ReferenceSegment>(referenced_table, referenced_column_id, rows.chunk_id,
+                                              rows.chunk_offsets);
+  }
+  return std::make_shared<ReferenceSegment>(referenced_table, referenced_column_id, rows.chunk_id,
+                                            rows.selection_bitmap);
+}
+
+std::string scan_type_to_string(const ScanType scan_type) {
+  switch (scan_type) {
+    case ScanType::OpEquals:
+      return "=";
+    case ScanType::OpNotEquals:
+      return "!=";
+    case ScanType::OpLessThan:
+      return "<";
+    case ScanType::OpLessThanEquals:
+      return "<=";
+    case ScanType::OpGreaterThan:
+      return ">";
+    case ScanType::OpGreaterThanEquals:
+      return ">=";
+  }
+  Fail("unknown scan type");
+  return "";
+}
+
+}  // namespace
+
 TableScan::TableScan(const std::shared_ptr<const AbstractOperator> in, ColumnID column_id, const ScanType scan_type,
                      const AllTypeVariant search_value)
-    : AbstractOperator(in), _column_id{column_id}, _scan_type{scan_type}, _search_value{search_value} {
-  const std::string& column_type = in->get_output()->column_type(column_id);
-  _table_scan_impl = make_unique_by_data_type<TableScan::BaseTableScanImpl, TableScan::TableScanImpl>(column_type);
-}
+    : AbstractPipelinedOperator(in), _column_id{column_id}, _scan_type{scan_type}, _search_value{search_value} {}
+
+TableScan::TableScan(const std::shared_ptr<const AbstractOperator> in, ColumnID column_id, const ScanType scan_type,
+                     const AllTypeVariant search_value, std::shared_ptr<BaseTableScanImpl> impl)
+    : AbstractPipelinedOperator(in),
+      _column_id{column_id},
+      _scan_type{scan_type},
+      _search_value{search_value},
+      _impl{std::move(impl)} {}
 
 TableScan::~TableScan() = default;
 
+std::string TableScan::name() const { return "TableScan"; }
+
+std::string TableScan::description() const {
+  // the column name is only known once the input has been executed, but scans keep the columns of their input, so
+  // preceding scans that have not been executed themselves (e.g., in a Pipeline) can be skipped
+  auto input = _input_left;
+  while (!input->get_output() && std::dynamic_pointer_cast<const TableScan>(input)) {
+    input = input->input_left();
+  }
+  const auto input_table = input->get_output();
+  auto stream = std::ostringstream{};
+  stream << name() << " ";
+  if (input_table) {
+    stream << input_table->column_name(_column_id);
+  } else {
+    stream << "#" << _column_id;
+  }
+  stream << " " << scan_type_to_string(_scan_type) << " " << _search_value;
+  return stream.str();
+}
+
 ColumnID TableScan::column_id() const { return _column_id; }
 
 ScanType TableScan::scan_type() const { return _scan_type; }
 
 const AllTypeVariant& TableScan::search_value() const { return _search_value; }
 
-std::shared_ptr<const Table> TableScan::_on_execute() { return _table_scan_impl->on_execute(*this); }
+void TableScan::prepare(const Table& input_table) const {
+  // the type of the column is only known once the input exists, the pipelines that share the scan resolve it once
+  std::call_once(_impl_resolved, [&]() {
+    if (!_impl) _impl = _create_impl(input_table.column_type(_column_id));
+  });
+}
+
+std::optional<Chunk> TableScan::execute_on_chunk(const std::shared_ptr<const Table>& input_table,
+                                                const ChunkID chunk_id, const Chunk& chunk) const {
+  DebugAssert(_impl, "TableScan: prepare has to be called before execute_on_chunk");
+  return _impl->on_chunk(*this, input_table, chunk_id, chunk);
+}
+
+std::shared_ptr<TableScan::BaseTableScanImpl> TableScan::_create_impl(const std::string& column_type) {
+  return make_shared_by_data_type<TableScan::BaseTableScanImpl, TableScan::TableScanImpl>(column_type);
+}
+
+Chunk TableScan::_create_output_chunk(const std::shared_ptr<const Table>& input_table, const ChunkID chunk_id,
+                                      const Chunk& chunk, SelectionBitmap&& matches) {
+  auto output_chunk = Chunk{};
+  const auto memory_resource = matches.words().get_allocator().resource();
+  const auto selection = std::allocate_shared<SelectionBitmap>(PolymorphicAllocator<SelectionBitmap>{memory_resource},
+                                                               std::move(matches));
+
+  // the segments of a chunk usually share their positions, so that the filtered positions are shared as well
+  const auto rows_of_input_chunk = compact_rows(chunk_id, selection);
+  auto filtered_rows = std::map<const void*, ReferencedRows>{};
+  auto filtered_pos_lists = std::map<const PosList*, std::shared_ptr<PosList>>{};
+
+  for (ColumnID column_id{0}; column_id < chunk.column_count(); ++column_id) {
+    const auto segment = chunk.get_segment(column_id);
+    const auto reference_segment = std::dynamic_pointer_cast<const ReferenceSegment>(segment);
+    if (!reference_segment) {
+      output_chunk.add_segment(create_reference_segment(input_table, column_id, rows_of_input_chunk));
+      continue;
+    }
+
+    const auto& referenced_table = reference_segment->referenced_table();
+    const auto referenced_column_id = reference_segment->referenced_column_id();
+
+    if (!reference_segment->references_single_chunk()) {
+      const auto& pos_list = *reference_segment->pos_list();
+      auto& filtered = filtered_pos_lists[&pos_list];
+      if (!filtered) {
+        filtered = std::allocate_shared<PosList>(PolymorphicAllocator<PosList>{memory_resource});
+        filtered->reserve(selection->size());
+        selection->for_each([&](const ChunkOffset offset) { filtered->push_back(pos_list[offset]); });
+      }
+      output_chunk.add_segment(std::make_shared<ReferenceSegment>(referenced_table, referenced_column_id, filtered));
+      continue;
+    }
+
+    const auto referenced_chunk_id = reference_segment->referenced_chunk_id();
+    const auto chunk_offsets = reference_segment->chunk_offsets();
+    const auto selection_bitmap = reference_segment->selection_bitmap();
+    auto& filtered = filtered_rows[chunk_offsets ? static_cast<const void*>(chunk_offsets.get())
+                                                 : static_cast<const void*>(selection_bitmap.get())];
+    if (filtered.chunk_id == INVALID_CHUNK_ID) {
+      if (chunk_offsets) {
+        // chunk offsets are not necessarily sorted, so that they remain chunk offsets to keep their order
+        auto filtered_chunk_offsets =
+            std::allocate_shared<ChunkOffsetList>(PolymorphicAllocator<ChunkOffsetList>{memory_resource});
+        filtered_chunk_offsets->reserve(selection->size());
+        selection->for_each(
+            [&](const ChunkOffset offset) { filtered_chunk_offsets->push_back((*chunk_offsets)[offset]); });
+        filtered = ReferencedRows{referenced_chunk_id, std::move(filtered_chunk_offsets), nullptr};
+      } else {
+        // refines the selection bitmap of the input, i.e., keeps its n-th selected row if the n-th row matched
+        auto words = pmr_vector<uint64_t>(selection_bitmap->words().size(), memory_resource);
+        auto index = ChunkOffset{0};
+        selection_bitmap->for_each([&](const ChunkOffset chunk_offset) {
+          words[chunk_offset / SelectionBitmap::BITS_PER_WORD] |= uint64_t{selection->is_selected(index++)}
+                                                                  << (chunk_offset % SelectionBitmap::BITS_PER_WORD);
+        });
+        filtered = compact_rows(referenced_chunk_id, std::allocate_shared<SelectionBitmap>(
+                                                         PolymorphicAllocator<SelectionBitmap>{memory_resource},
+                                                         std::move(words), selection_bitmap->chunk_size()));
+      }
+    }
+    output_chunk.add_segment(create_reference_segment(referenced_table, referenced_column_id, filtered));
+  }
+  return output_chunk;
+}
 
 }  // namespace opossum
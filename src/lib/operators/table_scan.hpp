@@ -1,39 +1,57 @@
 #pragma once
 
+#include <functional>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <string>
 #include <utility>
 #include <vector>
 
 #include "abstract_operator.hpp"
+#include "abstract_pipelined_operator.hpp"
 #include "all_type_variant.hpp"
 #include "storage/chunk.hpp"
 #include "storage/dictionary_segment.hpp"
 #include "storage/reference_segment.hpp"
+#include "storage/selection_bitmap.hpp"
 #include "storage/table.hpp"
 #include "storage/value_segment.hpp"
+#include "storage/value_vector.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
+#include "utils/hardware_counters.hpp"
+#include "utils/metrics.hpp"
+#include "utils/query_arena.hpp"
 
 namespace opossum {
 
 class Table;
 
-class TableScan : public AbstractOperator {
+// Filters the rows of the input by comparing one column with a search value. The output consists of reference
+// segments, and each input chunk with matches results in one output chunk, which only references rows of a single
+// chunk. Scans process every chunk independently and can therefore be fused into a Pipeline.
+class TableScan : public AbstractPipelinedOperator {
  protected:
   class BaseTableScanImpl {
    public:
     virtual ~BaseTableScanImpl() = default;
 
-    virtual std::shared_ptr<const Table> on_execute(const TableScan& tableScan) = 0;
+    // see TableScan::execute_on_chunk
+    virtual std::optional<Chunk> on_chunk(const TableScan& table_scan, const std::shared_ptr<const Table>& input_table,
+                                          const ChunkID chunk_id, const Chunk& chunk) = 0;
   };
-  std::shared_ptr<const Table> _on_execute() override;
   const ColumnID _column_id;
   const ScanType _scan_type;
   const AllTypeVariant _search_value;
 
-  std::unique_ptr<BaseTableScanImpl> _table_scan_impl;
+
+  // Creates the output chunk for the matching rows of an input chunk. Segments of stored tables are referenced with
+  // the matches, which are kept as a bitmap or converted to chunk offsets, whichever needs less memory. For reference
+  // segments, the output references the same table as the input, so that consecutive scans do not build chains of
+  // reference segments, and selection bitmaps are refined into new bitmaps.
+  static Chunk _create_output_chunk(const std::shared_ptr<const Table>& input_table, const ChunkID chunk_id,
+                                    const Chunk& chunk, SelectionBitmap&& matches);
 
   template <typename T>
   class TableScanImpl : public BaseTableScanImpl {
@@ -41,46 +59,30 @@ class TableScan : public AbstractOperator {
     ~TableScanImpl() = default;
 
    protected:
-    template <typename S>
-    std::function<bool(S, S)> get_comparator(ScanType scanType) {
-      std::function<bool(S, S)> result;
-      switch (scanType) {
-        case ScanType::OpEquals: {
-          result = [](S left, S right) { return left == right; };
-          break;
-        }
-
-        case ScanType::OpNotEquals: {
-          result = [](S left, S right) { return left != right; };
-          break;
-        }
-
-        case ScanType::OpLessThan: {
-          result = [](S left, S right) { return left < right; };
-          break;
-        }
-
-        case ScanType::OpLessThanEquals: {
-          result = [](S left, S right) { return left <= right; };
-          break;
-        }
-
-        case ScanType::OpGreaterThan: {
-          result = [](S left, S right) { return left > right; };
-          break;
-        }
-
-        case ScanType::OpGreaterThanEquals: {
-          result = [](S left, S right) { return left >= right; };
-          break;
-        }
+    // Calls functor(comparator) with a comparator object for the given scan type. Each scan type thereby gets its own
+    // instantiation of the functor, in which the comparison is inlined instead of being called through a pointer.
+    template <typename Functor>
+    static void _with_comparator(const ScanType scan_type, const Functor& functor) {
+      switch (scan_type) {
+        case ScanType::OpEquals:
+          return functor(std::equal_to<>{});
+        case ScanType::OpNotEquals:
+          return functor(std::not_equal_to<>{});
+        case ScanType::OpLessThan:
+          return functor(std::less<>{});
+        case ScanType::OpLessThanEquals:
+          return functor(std::less_equal<>{});
+        case ScanType::OpGreaterThan:
+          return functor(std::greater<>{});
+        case ScanType::OpGreaterThanEquals:
+          return functor(std::greater_equal<>{});
       }
-      return result;
+      Fail("unknown operator type");
     }
 
-    std::pair<ScanType, ValueID> search_values_for_reference_segment(const ScanType scan_type,
-                                                                     const ValueID lower_bound_id,
-                                                                     const ValueID upper_bound_id) {
+    static std::pair<ScanType, ValueID> search_values_for_reference_segment(const ScanType scan_type,
+                                                                            const ValueID lower_bound_id,
+                                                                            const ValueID upper_bound_id) {
       switch (scan_type) {
         case ScanType::OpEquals:
           return std::make_pair(ScanType::OpEquals, lower_bound_id);
@@ -104,130 +106,252 @@ class TableScan : public AbstractOperator {
       return std::make_pair(ScanType::OpEquals, INVALID_VALUE_ID);
     }
 
-    template <typename S>
-    void _search_within_vector(const std::vector<S>& values, const S& search_value,
-                               std::function<bool(S, S)> comparator, const ChunkID chunk_id,
-                               std::shared_ptr<PosList>& pos_list) {
-      for (ChunkOffset chunk_offset{0}; chunk_offset < values.size(); chunk_offset++) {
-        if (comparator(values[chunk_offset], search_value)) {
-          pos_list->push_back(RowID{chunk_id, chunk_offset});
+    // Sets the bit of each matching value in the words of a SelectionBitmap. Every word is assembled from a fixed
+    // number of comparisons without branches, which the compiler can unroll and vectorize.
+    template <typename Values, typename S, typename Comparator>
+    static void _search_within_vector(const Values& values, const S& search_value, const Comparator& comparator,
+                                      pmr_vector<uint64_t>& matches) {
+      constexpr auto bits_per_word = SelectionBitmap::BITS_PER_WORD;
+      const auto size = static_cast<ChunkOffset>(values.size());
+      const auto full_word_count = size / bits_per_word;
+
+      for (auto word_index = size_t{0}; word_index < full_word_count; ++word_index) {
+        const auto first_offset = static_cast<ChunkOffset>(word_index * bits_per_word);
+        auto word = uint64_t{0};
+        for (ChunkOffset bit = 0; bit < bits_per_word; ++bit) {
+          word |= uint64_t{comparator(values[first_offset + bit], search_value)} << bit;
         }
+        matches[word_index] = word;
+      }
+
+      for (auto chunk_offset = static_cast<ChunkOffset>(full_word_count * bits_per_word); chunk_offset < size;
+           ++chunk_offset) {
+        matches[full_word_count] |= uint64_t{comparator(values[chunk_offset], search_value)}
+                                    << (chunk_offset % bits_per_word);
+      }
+    }
+
+    // returns whether no value of a dictionary satisfies the predicate, given the bounds of the search value in it
+    static bool _dictionary_excludes_all_rows(const ScanType scan_type, const ValueID lower_bound,
+                                              const ValueID upper_bound) {
+      switch (scan_type) {
+        case ScanType::OpEquals:
+          return lower_bound == upper_bound;
+        case ScanType::OpNotEquals:
+          return lower_bound == ValueID{0} && upper_bound == INVALID_VALUE_ID;
+        case ScanType::OpLessThan:
+          return lower_bound == ValueID{0};
+        case ScanType::OpLessThanEquals:
+          return upper_bound == ValueID{0};
+        case ScanType::OpGreaterThan:
+          return upper_bound == INVALID_VALUE_ID;
+        case ScanType::OpGreaterThanEquals:
+          return lower_bound == INVALID_VALUE_ID;
       }
+      Fail("unknown operator type");
+      return false;
     }
 
     template <typename U>
     void _search_within_dictionary_segment(const std::shared_ptr<const FittedAttributeVector<U>>& attribute_vector,
-                                           const ScanType scan_type, const ChunkID chunk_id,
-                                           const ValueID search_value_lower_bound,
-                                           const ValueID search_value_upper_bound, std::shared_ptr<PosList>& pos_list) {
-      const std::vector<U>& values = attribute_vector->values();
+                                           const ScanType scan_type, const ValueID search_value_lower_bound,
+                                           const ValueID search_value_upper_bound, pmr_vector<uint64_t>& matches) {
+      const pmr_vector<U>& values = attribute_vector->values();
 
-      if (scan_type == ScanType::OpEquals && search_value_lower_bound == search_value_upper_bound) {
-        return;
-      } else if (scan_type == ScanType::OpNotEquals && search_value_lower_bound == search_value_upper_bound) {
+      if (scan_type == ScanType::OpNotEquals && search_value_lower_bound == search_value_upper_bound) {
         for (ChunkOffset chunk_offset{0}; chunk_offset < values.size(); chunk_offset++) {
-          pos_list->push_back(RowID{chunk_id, chunk_offset});
+          matches[chunk_offset / SelectionBitmap::BITS_PER_WORD] |= uint64_t{1}
+                                                                    << (chunk_offset % SelectionBitmap::BITS_PER_WORD);
         }
         return;
       }
 
       const auto new_search_values =
           search_values_for_reference_segment(scan_type, search_value_lower_bound, search_value_upper_bound);
-      const auto comparator = get_comparator<U>(new_search_values.first);
       const U new_search_value = static_cast<U>(new_search_values.second);
-      _search_within_vector(values, new_search_value, comparator, chunk_id, pos_list);
+      _with_comparator(new_search_values.first, [&](const auto& comparator) {
+        _search_within_vector(values, new_search_value, comparator, matches);
+      });
+    }
+
+    // Compares the referenced rows of one segment of the referenced table in place: the values of ValueSegments are
+    // compared directly, and the ValueIDs of DictionarySegments with the bounds of the search value. for_each_row calls
+    // its argument with the offset of each row in the ReferenceSegment and the chunk offset in the referenced segment.
+    template <typename ForEachRow>
+    static void _search_referenced_segment(const BaseSegment& segment, const ScanType scan_type, const T& search_value,
+                                           const ForEachRow& for_each_row, pmr_vector<uint64_t>& matches) {
+      const auto set_match = [&](const size_t offset, const bool match) {
+        matches[offset / SelectionBitmap::BITS_PER_WORD] |= uint64_t{match}
+                                                           << (offset % SelectionBitmap::BITS_PER_WORD);
+      };
+
+      if (const auto value_segment = dynamic_cast<const ValueSegment<T>*>(&segment)) {
+        const auto& values = value_segment->values();
+        const auto search_value_view = ValueView<T>{search_value};
+        _with_comparator(scan_type, [&](const auto& comparator) {
+          for_each_row([&](const size_t offset, const ChunkOffset chunk_offset) {
+            set_match(offset, comparator(values[chunk_offset], search_value_view));
+          });
+        });
+        return;
+      }
+
+      const auto dictionary_segment = dynamic_cast<const DictionarySegment<T>*>(&segment);
+      Assert(dictionary_segment, "referenced segment has an unexpected type");
+      const auto lower_bound = dictionary_segment->lower_bound(search_value);
+      const auto upper_bound = dictionary_segment->upper_bound(search_value);
+      if (_dictionary_excludes_all_rows(scan_type, lower_bound, upper_bound)) return;
+      if (scan_type == ScanType::OpNotEquals && lower_bound == upper_bound) {
+        for_each_row([&](const size_t offset, const ChunkOffset) { set_match(offset, true); });
+        return;
+      }
+
+      // the ValueIDs are compared as ValueID::base_type, so that INVALID_VALUE_ID is not truncated to the width
+      const auto [value_id_scan_type, search_value_id] =
+          search_values_for_reference_segment(scan_type, lower_bound, upper_bound);
+      const auto search_value_id_value = static_cast<ValueID::base_type>(search_value_id);
+      const auto search_value_ids = [&](const auto& value_ids) {
+        _with_comparator(value_id_scan_type, [&](const auto& comparator) {
+          for_each_row([&](const size_t offset, const ChunkOffset chunk_offset) {
+            const auto value_id = static_cast<ValueID::base_type>(value_ids[chunk_offset]);
+            set_match(offset, comparator(value_id, search_value_id_value));
+          });
+        });
+      };
+      const auto& attribute_vector = *dictionary_segment->attribute_vector();
+      switch (attribute_vector.width()) {
+        case sizeof(uint8_t):
+          return search_value_ids(static_cast<const FittedAttributeVector<uint8_t>&>(attribute_vector).values());
+        case sizeof(uint16_t):
+          return search_value_ids(static_cast<const FittedAttributeVector<uint16_t>&>(attribute_vector).values());
+        case sizeof(uint32_t):
+          return search_value_ids(static_cast<const FittedAttributeVector<uint32_t>&>(attribute_vector).values());
+      }
+      Fail("unsupported attribute vector width: " + std::to_string(attribute_vector.width()));
+    }
+
+    // scans the rows of a ReferenceSegment in the referenced segments, without materializing their values
+    static void _search_within_reference_segment(const ReferenceSegment& reference_segment, const ScanType scan_type,
+                                                 const T& search_value, pmr_vector<uint64_t>& matches) {
+      const auto& referenced_table = *reference_segment.referenced_table();
+      const auto column_id = reference_segment.referenced_column_id();
+
+      if (reference_segment.references_single_chunk()) {
+        const auto segment = referenced_table.get_chunk(reference_segment.referenced_chunk_id()).get_segment(column_id);
+        if (const auto chunk_offsets = reference_segment.chunk_offsets()) {
+          const auto for_each_row = [&](const auto& function) {
+            for (auto offset = size_t{0}; offset < chunk_offsets->size(); ++offset) {
+              function(offset, (*chunk_offsets)[offset]);
+            }
+          };
+          _search_referenced_segment(*segment, scan_type, search_value, for_each_row, matches);
+        } else {
+          const auto for_each_row = [&](const auto& function) {
+            auto offset = size_t{0};
+            reference_segment.selection_bitmap()->for_each(
+                [&](const ChunkOffset chunk_offset) { function(offset++, chunk_offset); });
+          };
+          _search_referenced_segment(*segment, scan_type, search_value, for_each_row, matches);
+        }
+        return;
+      }
+
+      // consecutive positions usually point into the same chunk, so that they are scanned together
+      const auto& pos_list = *reference_segment.pos_list();
+      for (auto begin = size_t{0}; begin < pos_list.size();) {
+        const auto referenced_chunk_id = pos_list[begin].chunk_id;
+        auto end = begin + 1;
+        while (end < pos_list.size() && pos_list[end].chunk_id == referenced_chunk_id) ++end;
+
+        const auto segment = referenced_table.get_chunk(referenced_chunk_id).get_segment(column_id);
+        const auto for_each_row = [&](const auto& function) {
+          for (auto offset = begin; offset < end; ++offset) function(offset, pos_list[offset].chunk_offset);
+        };
+        _search_referenced_segment(*segment, scan_type, search_value, for_each_row, matches);
+        begin = end;
+      }
     }
 
-    std::shared_ptr<const Table> on_execute(const TableScan& table_scan) override {
+    std::optional<Chunk> on_chunk(const TableScan& table_scan, const std::shared_ptr<const Table>& input_table,
+                                  const ChunkID chunk_id, const Chunk& chunk) override {
       const auto column_id = table_scan.column_id();
-      const auto input_table = table_scan.input_left()->get_output();
       const auto scan_type = table_scan.scan_type();
       const auto search_value = table_scan.search_value();
-      auto pos_list = std::make_shared<PosList>();
-
-      bool reference_segment_processed = false;
-
-      for (ChunkID chunk_id{0}; chunk_id < input_table->chunk_count(); chunk_id++) {
-        const Chunk& chunk = input_table->get_chunk(chunk_id);
-        const std::shared_ptr<BaseSegment> segment = chunk.get_segment(column_id);
-        const auto comparator = get_comparator<T>(scan_type);
-
-        if (std::dynamic_pointer_cast<ValueSegment<T>>(segment) != nullptr) {
-          const auto value_segment = std::static_pointer_cast<ValueSegment<T>>(segment);
-          const auto& values = value_segment->values();
-          const auto& casted_search_value = type_cast<T>(search_value);
-          _search_within_vector(values, casted_search_value, comparator, chunk_id, pos_list);
-        } else if (std::dynamic_pointer_cast<DictionarySegment<T>>(segment) != nullptr) {
-          const auto dictionary_segment = std::static_pointer_cast<DictionarySegment<T>>(segment);
-          const auto attribute_vector = dictionary_segment->attribute_vector();
-
-          const auto lower_bound = dictionary_segment->lower_bound(search_value);
-          const auto upper_bound = dictionary_segment->upper_bound(search_value);
-
-          switch (attribute_vector->width()) {
-            case sizeof(uint8_t): {
-              const auto fitted_attribute_vector =
-                  std::static_pointer_cast<const FittedAttributeVector<uint8_t>>(attribute_vector);
-              DebugAssert(fitted_attribute_vector != nullptr, "cast failed");
-              _search_within_dictionary_segment<uint8_t>(fitted_attribute_vector, scan_type, chunk_id, lower_bound,
-                                                         upper_bound, pos_list);
-              break;
-            }
-            case sizeof(uint16_t): {
-              const auto fitted_attribute_vector =
-                  std::static_pointer_cast<const FittedAttributeVector<uint16_t>>(attribute_vector);
-              DebugAssert(fitted_attribute_vector != nullptr, "cast failed");
-              _search_within_dictionary_segment<uint16_t>(fitted_attribute_vector, scan_type, chunk_id, lower_bound,
-                                                          upper_bound, pos_list);
-              break;
-            }
-            case sizeof(uint32_t): {
-              const auto fitted_attribute_vector =
-                  std::static_pointer_cast<const FittedAttributeVector<uint32_t>>(attribute_vector);
-              DebugAssert(fitted_attribute_vector != nullptr, "cast failed");
-              _search_within_dictionary_segment<uint32_t>(fitted_attribute_vector, scan_type, chunk_id, lower_bound,
-                                                          upper_bound, pos_list);
-              break;
-            }
+      // the positions are allocated from the query arena of the thread, if there is one
+      const auto allocator = PolymorphicAllocator<uint64_t>{QueryArena::current_memory_resource()};
+      const auto casted_search_value = type_cast<T>(search_value);
+      // strings are compared as string_views, so that the values of StringVectors need not be copied
+      const auto search_value_view = ValueView<T>{casted_search_value};
+
+      // keeps the BufferManager from evicting the chunk while it is scanned
+      const ChunkPin chunk_pin(chunk);
+      const std::shared_ptr<BaseSegment> segment = chunk.get_segment(column_id);
+      const auto chunk_size = static_cast<ChunkOffset>(segment->size());
+      auto matches = pmr_vector<uint64_t>(SelectionBitmap::word_count(chunk_size), allocator);
+      const auto hardware_counters_before = HardwareCounters::read();
+
+      if (std::dynamic_pointer_cast<ValueSegment<T>>(segment) != nullptr) {
+        const auto value_segment = std::static_pointer_cast<ValueSegment<T>>(segment);
+        const auto& values = value_segment->values();
+        _with_comparator(scan_type, [&](const auto& comparator) {
+          _search_within_vector(values, search_value_view, comparator, matches);
+        });
+      } else if (std::dynamic_pointer_cast<DictionarySegment<T>>(segment) != nullptr) {
+        const auto dictionary_segment = std::static_pointer_cast<DictionarySegment<T>>(segment);
+        const auto attribute_vector = dictionary_segment->attribute_vector();
+
+        const auto lower_bound = dictionary_segment->lower_bound(search_value);
+        const auto upper_bound = dictionary_segment->upper_bound(search_value);
+
+        // the chunk is pruned if the dictionary shows that no row can match, without scanning the attribute vector
+        if (_dictionary_excludes_all_rows(scan_type, lower_bound, upper_bound)) {
+          table_scan._register_pruned_chunk();
+          return std::nullopt;
+        }
 
-            default: { Fail("unsupported attribute vector width: " + std::to_string(attribute_vector->width())); }
+        switch (attribute_vector->width()) {
+          case sizeof(uint8_t): {
+            const auto fitted_attribute_vector =
+                std::static_pointer_cast<const FittedAttributeVector<uint8_t>>(attribute_vector);
+            DebugAssert(fitted_attribute_vector != nullptr, "cast failed");
+            _search_within_dictionary_segment<uint8_t>(fitted_attribute_vector, scan_type, lower_bound, upper_bound,
+                                                       matches);
+            break;
           }
-        } else if (std::dynamic_pointer_cast<ReferenceSegment>(segment) != nullptr) {
-          DebugAssert(chunk_id == 0, "there should always be only 1 chunk for reference segments");
-          reference_segment_processed = true;
-          const auto reference_segment = std::static_pointer_cast<ReferenceSegment>(segment);
-          const auto old_pos_list = reference_segment->pos_list();
-          const T& casted_search_value = type_cast<T>(search_value);
-
-          for (ChunkOffset chunk_offset{0}; chunk_offset < reference_segment->size(); chunk_offset++) {
-            if (comparator(type_cast<T>(reference_segment->operator[](chunk_offset)), casted_search_value)) {
-              pos_list->push_back(old_pos_list->operator[](chunk_offset));
-            }
+          case sizeof(uint16_t): {
+            const auto fitted_attribute_vector =
+                std::static_pointer_cast<const FittedAttributeVector<uint16_t>>(attribute_vector);
+            DebugAssert(fitted_attribute_vector != nullptr, "cast failed");
+            _search_within_dictionary_segment<uint16_t>(fitted_attribute_vector, scan_type, lower_bound,
+                                                        upper_bound, matches);
+            break;
+          }
+          case sizeof(uint32_t): {
+            const auto fitted_attribute_vector =
+                std::static_pointer_cast<const FittedAttributeVector<uint32_t>>(attribute_vector);
+            DebugAssert(fitted_attribute_vector != nullptr, "cast failed");
+            _search_within_dictionary_segment<uint32_t>(fitted_attribute_vector, scan_type, lower_bound,
+                                                        upper_bound, matches);
+            break;
           }
 
-        } else {
-          Fail("unknown segment type");
+          default: { Fail("unsupported attribute vector width: " + std::to_string(attribute_vector->width())); }
         }
+      } else if (std::dynamic_pointer_cast<ReferenceSegment>(segment) != nullptr) {
+        const auto reference_segment = std::static_pointer_cast<ReferenceSegment>(segment);
+        _search_within_reference_segment(*reference_segment, scan_type, casted_search_value, matches);
+      } else {
+        Fail("unknown segment type");
       }
 
-      auto result_table = std::make_shared<Table>();
-      Chunk chunk;
-      for (ColumnID col_id{0}; col_id < input_table->column_count(); col_id++) {
-        result_table->add_column(input_table->column_name(col_id), input_table->column_type(col_id));
-
-        if (reference_segment_processed) {
-          // a reference segment always only references one table, thus we can use the second input_left()
-          const auto segment =
-              std::make_shared<ReferenceSegment>(table_scan.input_left()->input_left()->get_output(), col_id, pos_list);
-          chunk.add_segment(segment);
-        } else {
-          const auto segment = std::make_shared<ReferenceSegment>(input_table, col_id, pos_list);
-          chunk.add_segment(segment);
-        }
-      }
+      table_scan._register_kernel_hardware_counters(HardwareCounters::read() - hardware_counters_before);
+      static auto& scanned_rows = MetricsRegistry::get().counter(
+          "opossum_table_scan_rows_scanned_total", "Number of rows that TableScans compared with their search value");
+      scanned_rows.increment(chunk_size);
 
-      result_table->emplace_chunk(std::move(chunk));
-      return result_table;
+      auto selection_bitmap = SelectionBitmap(std::move(matches), chunk_size);
+      if (selection_bitmap.size() == 0) return std::nullopt;
+      return _create_output_chunk(input_table, chunk_id, chunk, std::move(selection_bitmap));
     }
   };
 
@@ -240,6 +364,29 @@ class TableScan : public AbstractOperator {
   ColumnID column_id() const;
   ScanType scan_type() const;
   const AllTypeVariant& search_value() const;
+
+  std::string name() const override;
+  std::string description() const override;
+
+  // resolves the implementation for the type of the scanned column, unless it was given on construction
+  void prepare(const Table& input_table) const override;
+
+  std::optional<Chunk> execute_on_chunk(const std::shared_ptr<const Table>& input_table, const ChunkID chunk_id,
+                                        const Chunk& chunk) const override;
+
+ protected:
+  friend class PreparedPlan;
+
+  // creates a scan whose implementation has already been resolved for the type of the column
+  TableScan(const std::shared_ptr<const AbstractOperator> in, ColumnID column_id, const ScanType scan_type,
+            const AllTypeVariant search_value, std::shared_ptr<BaseTableScanImpl> impl);
+
+  // the implementations are stateless, so that the scans of a PreparedPlan can share them
+  static std::shared_ptr<BaseTableScanImpl> _create_impl(const std::string& column_type);
+
+  // resolved once by prepare if not given, so that execute_on_chunk does not have to resolve it for every chunk
+  mutable std::shared_ptr<BaseTableScanImpl> _impl;
+  mutable std::once_flag _impl_resolved;
 };
 
 }  // namespace opossum
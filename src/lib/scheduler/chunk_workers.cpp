@@ -0,0 +1,94 @@
+#include "chunk_workers.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "topology.hpp"
+#include "utils/assert.hpp"
+#include "utils/metrics.hpp"
+#include "utils/tracing.hpp"
+
+namespace opossum {
+
+namespace {
+
+// the chunks of one node, which are handed out to the workers one by one
+struct NodeQueue {
+  std::vector<ChunkID> chunk_ids;
+  std::atomic<size_t> next_index{0};
+
+  std::optional<ChunkID> pop() {
+    const auto index = next_index++;
+    if (index >= chunk_ids.size()) return std::nullopt;
+    return chunk_ids[index];
+  }
+};
+
+}  // namespace
+
+void for_each_chunk_on_owning_node(const size_t chunk_count, const std::function<NodeID(ChunkID)>& node_of_chunk,
+                                   const std::function<void(ChunkID, NodeID)>& function) {
+  const auto& topology = Topology::get();
+  const auto node_count = topology.node_count();
+
+  auto queues = std::vector<NodeQueue>(node_count);
+  for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto node_id = node_of_chunk(chunk_id);
+    DebugAssert(node_id < node_count, "chunk assigned to an invalid node");
+    queues[node_id].chunk_ids.push_back(chunk_id);
+  }
+
+  auto exceptions = std::vector<std::exception_ptr>{};
+  auto worker_nodes = std::vector<NodeID>{};
+  for (auto node_id = NodeID{0}; node_id < node_count; ++node_id) {
+    const auto worker_count = std::min(topology.nodes()[node_id].cpu_ids.size(), queues[node_id].chunk_ids.size());
+    worker_nodes.insert(worker_nodes.end(), worker_count, node_id);
+  }
+  exceptions.resize(worker_nodes.size());
+
+  static auto& pinning_failures = MetricsRegistry::get().counter(
+      "opossum_thread_pinning_failures_total", "Workers that could not be pinned to the CPUs of their NUMA node");
+
+  auto threads = std::vector<std::thread>{};
+  for (auto worker_id = size_t{0}; worker_id < worker_nodes.size(); ++worker_id) {
+    threads.emplace_back([&, worker_id]() {
+      const auto worker_node_id = worker_nodes[worker_id];
+      if (Tracer::is_enabled()) {
+        Tracer::set_thread_name("worker " + std::to_string(worker_id) + " (node " + std::to_string(worker_node_id) +
+                                ")");
+      }
+      // an unpinned worker still processes the chunks of its node, but may access their memory remotely
+      if (!topology.pin_current_thread(worker_node_id)) {
+        pinning_failures.increment();
+        TRACE_INSTANT("scheduler", "pinning failed", "node " + std::to_string(worker_node_id));
+      }
+
+      // exceptions must not leave the thread, so they are passed on to the calling thread
+      try {
+        // the own node's queue comes first, then the queues of the following nodes
+        for (auto offset = NodeID{0}; offset < node_count; ++offset) {
+          auto& queue = queues[(worker_node_id + offset) % node_count];
+          for (auto chunk_id = queue.pop(); chunk_id; chunk_id = queue.pop()) {
+            TRACE_SPAN("job", "chunk " + std::to_string(*chunk_id));
+            function(*chunk_id, worker_node_id);
+          }
+        }
+      } catch (...) {
+        exceptions[worker_id] = std::current_exception();
+      }
+    });
+  }
+  for (auto& thread : threads) thread.join();
+  for (const auto& exception : exceptions) {
+    if (exception) std::rethrow_exception(exception);
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,19 @@
+#pragma once
+
+#include <functional>
+
+#include "types.hpp"
+
+namespace opossum {
+
+// Calls function(chunk_id, worker_node_id) for every chunk id below chunk_count in parallel and returns once all calls
+// have finished. For every node of the Topology, worker threads are started and pinned to the node's CPUs. They first
+// process the chunks that node_of_chunk assigns to their node and then help with the chunks of the other nodes, so that
+// a node that runs out of work does not idle. Memory that the function allocates is therefore usually placed on the
+// chunk's node; worker_node_id tells where it actually ran.
+//
+// The first exception thrown by the function is rethrown in the calling thread after all workers have finished.
+void for_each_chunk_on_owning_node(const size_t chunk_count, const std::function<NodeID(ChunkID)>& node_of_chunk,
+                                   const std::function<void(ChunkID, NodeID)>& function);
+
+}  // namespace opossum
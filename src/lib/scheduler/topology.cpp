@@ -0,0 +1,137 @@
+#include "topology.hpp"
+
+#include <linux/mempolicy.h>
+#include <pthread.h>
+#include <sched.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// the node to which the thread has been pinned via Topology::pin_current_thread
+thread_local NodeID current_thread_node_id = UNKNOWN_NODE_ID;
+
+uint32_t _hardware_concurrency() { return std::max(std::thread::hardware_concurrency(), 1u); }
+
+// returns the first line of a file, or an empty string if it cannot be read
+std::string _read_line(const std::string& file_name) {
+  std::ifstream file(file_name);
+  auto line = std::string{};
+  std::getline(file, line);
+  return line;
+}
+
+// lets the calling thread allocate memory on the given node of the operating system, as long as it has free memory
+void _prefer_memory_of_node(const uint32_t os_node_id) {
+  constexpr auto BITS_PER_WORD = sizeof(unsigned long) * 8;  // NOLINT(runtime/int)
+  auto node_mask = std::vector<unsigned long>(os_node_id / BITS_PER_WORD + 1);  // NOLINT(runtime/int)
+  node_mask[os_node_id / BITS_PER_WORD] |= 1ul << (os_node_id % BITS_PER_WORD);
+  // the kernel reads one bit less than the given maximum, the pinning still works if it refuses the policy
+  syscall(SYS_set_mempolicy, MPOL_PREFERRED, node_mask.data(), node_mask.size() * BITS_PER_WORD + 1);
+}
+
+}  // namespace
+
+Topology::Topology() { use_system_topology(); }
+
+Topology& Topology::get() {
+  static Topology instance;
+  return instance;
+}
+
+void Topology::use_system_topology() {
+  _nodes.clear();
+  _is_simulated = false;
+
+  // the ids of the online nodes may have gaps, e.g., "0,2-3"
+  for (const auto os_node_id : _parse_cpu_list(_read_line("/sys/devices/system/node/online"))) {
+    auto cpu_ids = _parse_cpu_list(
+        _read_line("/sys/devices/system/node/node" + std::to_string(os_node_id) + "/cpulist"));
+    // nodes without CPUs (e.g., memory-only nodes) cannot run workers
+    if (!cpu_ids.empty()) _nodes.push_back(TopologyNode{std::move(cpu_ids), os_node_id});
+  }
+
+  if (_nodes.empty()) {
+    auto cpu_ids = std::vector<uint32_t>(_hardware_concurrency());
+    for (auto cpu_id = uint32_t{0}; cpu_id < cpu_ids.size(); ++cpu_id) cpu_ids[cpu_id] = cpu_id;
+    _nodes.push_back(TopologyNode{std::move(cpu_ids), 0});
+  }
+}
+
+void Topology::use_simulated_topology(const uint32_t node_count, const uint32_t cpus_per_node) {
+  Assert(node_count > 0 && cpus_per_node > 0, "a topology needs at least one node with one CPU");
+  _nodes.clear();
+  _is_simulated = true;
+
+  const auto hardware_concurrency = _hardware_concurrency();
+  for (auto node_id = NodeID{0}; node_id < node_count; ++node_id) {
+    auto cpu_ids = std::vector<uint32_t>{};
+    for (auto cpu_index = uint32_t{0}; cpu_index < cpus_per_node; ++cpu_index) {
+      cpu_ids.push_back((node_id * cpus_per_node + cpu_index) % hardware_concurrency);
+    }
+    _nodes.push_back(TopologyNode{std::move(cpu_ids), 0});
+  }
+}
+
+const std::vector<TopologyNode>& Topology::nodes() const { return _nodes; }
+
+uint32_t Topology::node_count() const { return static_cast<uint32_t>(_nodes.size()); }
+
+bool Topology::is_simulated() const { return _is_simulated; }
+
+NodeID Topology::node_for_chunk(const ChunkID chunk_id, const size_t chunk_count,
+                                const ChunkPlacement placement) const {
+  DebugAssert(chunk_id < chunk_count, "invalid chunk id");
+  switch (placement) {
+    case ChunkPlacement::RoundRobin:
+      return static_cast<NodeID>(chunk_id % _nodes.size());
+    case ChunkPlacement::Partitioned:
+      return static_cast<NodeID>(static_cast<size_t>(chunk_id) * _nodes.size() / chunk_count);
+  }
+  Fail("unknown chunk placement");
+  return UNKNOWN_NODE_ID;
+}
+
+bool Topology::pin_current_thread(const NodeID node_id) const {
+  DebugAssert(node_id < _nodes.size(), "invalid node id");
+  current_thread_node_id = node_id;
+
+  cpu_set_t cpu_set;
+  CPU_ZERO(&cpu_set);
+  for (const auto cpu_id : _nodes[node_id].cpu_ids) {
+    CPU_SET(cpu_id, &cpu_set);
+  }
+  if (!_is_simulated) _prefer_memory_of_node(_nodes[node_id].os_node_id);
+  return pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set) == 0;
+}
+
+NodeID Topology::current_node_id() { return current_thread_node_id; }
+
+void Topology::reset() { get().use_system_topology(); }
+
+std::vector<uint32_t> Topology::_parse_cpu_list(const std::string& cpu_list) {
+  auto cpu_ids = std::vector<uint32_t>{};
+  auto stream = std::stringstream{cpu_list};
+  auto range = std::string{};
+  while (std::getline(stream, range, ',')) {
+    if (range.empty()) continue;
+    const auto dash = range.find('-');
+    const auto first = static_cast<uint32_t>(std::stoul(range.substr(0, dash)));
+    const auto last = dash == std::string::npos ? first : static_cast<uint32_t>(std::stoul(range.substr(dash + 1)));
+    for (auto cpu_id = first; cpu_id <= last; ++cpu_id) cpu_ids.push_back(cpu_id);
+  }
+  return cpu_ids;
+}
+
+}  // namespace opossum
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+struct TopologyNode {
+  // ids of the CPUs that belong to the node, as used by sched_setaffinity
+  std::vector<uint32_t> cpu_ids;
+  // The id of the node in the operating system, which differs from its NodeID if the system's node ids are sparse or
+  // nodes without CPUs have been skipped. Simulated nodes use 0, as their memory is not placed explicitly.
+  uint32_t os_node_id = 0;
+};
+
+// The Topology is a singleton that describes the NUMA nodes of the machine and the CPUs that belong to them. It is
+// read from /sys/devices/system/node on Linux. Machines without NUMA information are treated as a single node. The
+// nodes with CPUs are numbered consecutively by their NodeIDs, which map to the ids of the operating system.
+//
+// Memory is placed on a node by allocating it from a thread that is pinned to the node's CPUs (Linux places pages on
+// the node of the CPU that touches them first), and pinned threads also prefer the memory of their node if the process
+// may not use its CPUs. To test NUMA-aware code on a single-node machine, a topology with
+// several simulated nodes can be used. Their CPUs are mapped round-robin onto the actual CPUs, so that pinning still
+// works, but the memory of all simulated nodes ends up on the same physical node.
+//
+// The topology must not be changed while operators are running.
+class Topology : private Noncopyable {
+ public:
+  static Topology& get();
+
+  void use_system_topology();
+  void use_simulated_topology(const uint32_t node_count, const uint32_t cpus_per_node);
+
+  const std::vector<TopologyNode>& nodes() const;
+  uint32_t node_count() const;
+  bool is_simulated() const;
+
+  // returns the node on which the given chunk of a table with chunk_count chunks should be placed
+  NodeID node_for_chunk(const ChunkID chunk_id, const size_t chunk_count, const ChunkPlacement placement) const;
+
+  // restricts the calling thread to the CPUs of the given node and lets it prefer the memory of the node, returns
+  // false if the operating system refused the CPUs (e.g., because they are not available to the process), in which
+  // case the thread can still run anywhere
+  bool pin_current_thread(const NodeID node_id) const;
+
+  // returns the node to which the calling thread has been pinned, or UNKNOWN_NODE_ID if it has not been pinned
+  static NodeID current_node_id();
+
+  // switches back to the topology of the system
+  static void reset();
+
+ protected:
+  Topology();
+
+  // parses the CPU and node lists of the sysfs, e.g., "0-3,8-11"
+  static std::vector<uint32_t> _parse_cpu_list(const std::string& cpu_list);
+
+  std::vector<TopologyNode> _nodes;
+  bool _is_simulated = false;
+};
+
+}  // namespace opossum
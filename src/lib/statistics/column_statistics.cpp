@@ -0,0 +1,248 @@
+#include "column_statistics.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "storage/dictionary_segment.hpp"
+#include "storage/fitted_attribute_vector.hpp"
+#include "storage/value_segment.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+#include "utils/performance_warning.hpp"
+
+namespace opossum {
+
+namespace {
+
+// the position of a string between 0 and 1, considering up to eight characters behind a prefix that is ignored
+double string_position(const std::string& value, const size_t prefix_length) {
+  auto position = 0.0;
+  auto factor = 1.0;
+  for (auto index = prefix_length; index < value.size() && index < prefix_length + 8; ++index) {
+    factor /= 256.0;
+    position += static_cast<unsigned char>(value[index]) * factor;
+  }
+  return position;
+}
+
+// Returns the estimated share of the values of the bucket that are less than the given value, which has to be greater
+// than the minimum and not greater than the maximum. The values are assumed to be distributed uniformly.
+template <typename T>
+double share_below(const HistogramBucket<T>& bucket, const T& value) {
+  if constexpr (std::is_integral_v<T>) {
+    return (static_cast<double>(value) - static_cast<double>(bucket.min)) /
+           (static_cast<double>(bucket.max) - static_cast<double>(bucket.min) + 1.0);
+  } else if constexpr (std::is_floating_point_v<T>) {
+    return (static_cast<double>(value) - static_cast<double>(bucket.min)) /
+           (static_cast<double>(bucket.max) - static_cast<double>(bucket.min));
+  } else {
+    // strings are interpolated by the characters behind the prefix that all values of the bucket share
+    const auto prefix_length = static_cast<size_t>(
+        std::distance(bucket.min.cbegin(),
+                      std::mismatch(bucket.min.cbegin(), bucket.min.cend(), bucket.max.cbegin(), bucket.max.cend())
+                          .first));
+    const auto min_position = string_position(bucket.min, prefix_length);
+    const auto range = string_position(bucket.max, prefix_length) - min_position;
+    if (range <= 0.0) return 0.5;
+    return std::clamp((string_position(value, prefix_length) - min_position) / range, 0.0, 1.0);
+  }
+}
+
+template <typename AttributeVectorType>
+void count_attribute_vector(const BaseAttributeVector& attribute_vector, std::vector<uint64_t>& counts) {
+  const auto& values = static_cast<const FittedAttributeVector<AttributeVectorType>&>(attribute_vector).values();
+  for (const auto value_id : values) {
+    ++counts[value_id];
+  }
+}
+
+// turns sorted values into pairs of the distinct values and their number of occurrences
+template <typename T>
+std::vector<std::pair<T, uint64_t>> count_sorted_values(std::vector<T>&& values) {
+  auto value_counts = std::vector<std::pair<T, uint64_t>>{};
+  for (auto& value : values) {
+    if (value_counts.empty() || value_counts.back().first != value) {
+      value_counts.emplace_back(std::move(value), 0);
+    }
+    ++value_counts.back().second;
+  }
+  return value_counts;
+}
+
+}  // namespace
+
+BaseColumnStatistics::BaseColumnStatistics(const uint64_t row_count, const uint64_t distinct_count)
+    : _row_count(row_count), _distinct_count(distinct_count) {}
+
+uint64_t BaseColumnStatistics::row_count() const { return _row_count; }
+
+uint64_t BaseColumnStatistics::distinct_count() const { return _distinct_count; }
+
+float BaseColumnStatistics::null_fraction() const { return 0.0f; }
+
+double BaseColumnStatistics::estimate_selectivity(const ScanType scan_type, const AllTypeVariant& value) const {
+  if (_row_count == 0) return 0.0;
+  return estimate_row_count(scan_type, value) / static_cast<double>(_row_count);
+}
+
+template <typename T>
+ColumnStatistics<T>::ColumnStatistics(const std::vector<std::pair<T, uint64_t>>& value_counts,
+                                      const size_t bucket_count)
+    : BaseColumnStatistics(
+          std::accumulate(value_counts.cbegin(), value_counts.cend(), uint64_t{0},
+                          [](const uint64_t sum, const std::pair<T, uint64_t>& entry) { return sum + entry.second; }),
+          value_counts.size()) {
+  DebugAssert(bucket_count > 0, "a histogram needs at least one bucket");
+  DebugAssert(std::is_sorted(value_counts.cbegin(), value_counts.cend()), "the values must be sorted");
+
+  // a bucket is closed once it has reached the target depth, so that frequent values may lead to fewer buckets
+  const auto target_row_count = (_row_count + bucket_count - 1) / bucket_count;
+  for (const auto& [value, count] : value_counts) {
+    if (_buckets.empty() || _buckets.back().row_count >= target_row_count) {
+      _buckets.push_back(HistogramBucket<T>{value, value, 0, 0});
+    }
+    auto& bucket = _buckets.back();
+    bucket.max = value;
+    bucket.row_count += count;
+    ++bucket.distinct_count;
+  }
+}
+
+template <typename T>
+std::vector<std::pair<T, uint64_t>> ColumnStatistics<T>::count_values(const BaseSegment& segment) {
+  if (const auto dictionary_segment = dynamic_cast<const DictionarySegment<T>*>(&segment)) {
+    const auto& dictionary = *dictionary_segment->dictionary();
+    auto value_counts = std::vector<std::pair<T, uint64_t>>{};
+    for (const auto& [value_id, count] : count_value_ids(*dictionary_segment)) {
+      value_counts.emplace_back(T{dictionary[value_id]}, count);
+    }
+    return value_counts;
+  }
+
+  auto values = std::vector<T>{};
+  values.reserve(segment.size());
+  if (const auto value_segment = dynamic_cast<const ValueSegment<T>*>(&segment)) {
+    for (const auto& value : value_segment->values()) {
+      values.emplace_back(value);
+    }
+  } else {
+    PerformanceWarning("statistics are computed from a segment that is neither a ValueSegment nor a DictionarySegment");
+    for (auto index = size_t{0}; index < segment.size(); ++index) {
+      values.push_back(type_cast<T>(segment[index]));
+    }
+  }
+  std::sort(values.begin(), values.end());
+  return count_sorted_values(std::move(values));
+}
+
+template <typename T>
+std::vector<std::pair<ValueID, uint64_t>> ColumnStatistics<T>::count_value_ids(const DictionarySegment<T>& segment) {
+  // a dictionary that is shared by the segments of a column may contain values that the segment does not contain
+  auto counts = std::vector<uint64_t>(segment.dictionary()->size());
+  const auto& attribute_vector = *segment.attribute_vector();
+  switch (attribute_vector.width()) {
+    case sizeof(uint8_t):
+      count_attribute_vector<uint8_t>(attribute_vector, counts);
+      break;
+    case sizeof(uint16_t):
+      count_attribute_vector<uint16_t>(attribute_vector, counts);
+      break;
+    case sizeof(uint32_t):
+      count_attribute_vector<uint32_t>(attribute_vector, counts);
+      break;
+    default:
+      Fail("unsupported attribute vector width: " + std::to_string(attribute_vector.width()));
+  }
+
+  auto value_id_counts = std::vector<std::pair<ValueID, uint64_t>>{};
+  for (ValueID value_id{0}; value_id < counts.size(); ++value_id) {
+    if (counts[value_id] > 0) value_id_counts.emplace_back(value_id, counts[value_id]);
+  }
+  return value_id_counts;
+}
+
+template <typename T>
+AllTypeVariant ColumnStatistics<T>::min() const {
+  Assert(!_buckets.empty(), "an empty column has no minimum");
+  return _buckets.front().min;
+}
+
+template <typename T>
+AllTypeVariant ColumnStatistics<T>::max() const {
+  Assert(!_buckets.empty(), "an empty column has no maximum");
+  return _buckets.back().max;
+}
+
+template <typename T>
+size_t ColumnStatistics<T>::bucket_count() const {
+  return _buckets.size();
+}
+
+template <typename T>
+const std::vector<HistogramBucket<T>>& ColumnStatistics<T>::buckets() const {
+  return _buckets;
+}
+
+template <typename T>
+typename std::vector<HistogramBucket<T>>::const_iterator ColumnStatistics<T>::_bucket_not_below(const T& value) const {
+  return std::lower_bound(_buckets.cbegin(), _buckets.cend(), value,
+                          [](const HistogramBucket<T>& bucket, const T& value) { return bucket.max < value; });
+}
+
+template <typename T>
+double ColumnStatistics<T>::_estimate_equals(const T& value) const {
+  const auto bucket = _bucket_not_below(value);
+  if (bucket == _buckets.cend() || value < bucket->min) return 0.0;
+  return static_cast<double>(bucket->row_count) / static_cast<double>(bucket->distinct_count);
+}
+
+template <typename T>
+double ColumnStatistics<T>::_estimate_less_than(const T& value) const {
+  const auto bucket = _bucket_not_below(value);
+  auto row_count = 0.0;
+  for (auto lower_bucket = _buckets.cbegin(); lower_bucket != bucket; ++lower_bucket) {
+    row_count += static_cast<double>(lower_bucket->row_count);
+  }
+  if (bucket != _buckets.cend() && bucket->min < value) {
+    row_count += static_cast<double>(bucket->row_count) * share_below(*bucket, value);
+  }
+  return row_count;
+}
+
+template <typename T>
+double ColumnStatistics<T>::estimate_row_count(const ScanType scan_type, const AllTypeVariant& value) const {
+  const auto typed_value = type_cast<T>(value);
+  const auto row_count = static_cast<double>(_row_count);
+  auto estimate = 0.0;
+  switch (scan_type) {
+    case ScanType::OpEquals:
+      estimate = _estimate_equals(typed_value);
+      break;
+    case ScanType::OpNotEquals:
+      estimate = row_count - _estimate_equals(typed_value);
+      break;
+    case ScanType::OpLessThan:
+      estimate = _estimate_less_than(typed_value);
+      break;
+    case ScanType::OpLessThanEquals:
+      estimate = _estimate_less_than(typed_value) + _estimate_equals(typed_value);
+      break;
+    case ScanType::OpGreaterThan:
+      estimate = row_count - _estimate_less_than(typed_value) - _estimate_equals(typed_value);
+      break;
+    case ScanType::OpGreaterThanEquals:
+      estimate = row_count - _estimate_less_than(typed_value);
+      break;
+  }
+  // the estimates of the range and the equality within a bucket may overlap
+  return std::clamp(estimate, 0.0, row_count);
+}
+
+EXPLICITLY_INSTANTIATE_DATA_TYPES(ColumnStatistics);
+
+}  // namespace opossum
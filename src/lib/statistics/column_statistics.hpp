@@ -0,0 +1,91 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseSegment;
+template <typename T>
+class DictionarySegment;
+
+// A bucket of an equi-depth histogram, i.e., a range of values that occur in roughly as many rows as the values of the
+// other buckets.
+template <typename T>
+struct HistogramBucket {
+  T min;
+  T max;
+  uint64_t row_count;
+  uint64_t distinct_count;
+};
+
+// Statistics about the values of a column, or of a column within a chunk, which are used to estimate how many rows
+// satisfy a predicate (see TableStatistics).
+class BaseColumnStatistics : private Noncopyable {
+ public:
+  static constexpr size_t DEFAULT_BUCKET_COUNT = 32;
+
+  BaseColumnStatistics(uint64_t row_count, uint64_t distinct_count);
+  virtual ~BaseColumnStatistics() = default;
+
+  uint64_t row_count() const;
+  uint64_t distinct_count() const;
+
+  // our segments cannot store NULLs yet, so that this is always 0
+  float null_fraction() const;
+
+  // the smallest and the largest value, the column must not be empty
+  virtual AllTypeVariant min() const = 0;
+  virtual AllTypeVariant max() const = 0;
+
+  virtual size_t bucket_count() const = 0;
+
+  // returns the estimated number of rows for which "column <scan_type> value" holds
+  virtual double estimate_row_count(ScanType scan_type, const AllTypeVariant& value) const = 0;
+
+  // returns the estimated share of the rows for which "column <scan_type> value" holds
+  double estimate_selectivity(ScanType scan_type, const AllTypeVariant& value) const;
+
+ protected:
+  const uint64_t _row_count;
+  const uint64_t _distinct_count;
+};
+
+template <typename T>
+class ColumnStatistics : public BaseColumnStatistics {
+ public:
+  // creates the statistics from the distinct values in ascending order and the number of rows that contain them
+  ColumnStatistics(const std::vector<std::pair<T, uint64_t>>& value_counts, size_t bucket_count);
+
+  // Returns the distinct values of the segment in ascending order and the number of rows that contain them. For
+  // DictionarySegments, the values are counted by their ValueIDs without comparing any values.
+  static std::vector<std::pair<T, uint64_t>> count_values(const BaseSegment& segment);
+
+  // Returns the ValueIDs of the values that the segment contains in ascending order and the number of rows that contain
+  // them, which refer to the values in the dictionary of the segment without copying them.
+  static std::vector<std::pair<ValueID, uint64_t>> count_value_ids(const DictionarySegment<T>& segment);
+
+  AllTypeVariant min() const override;
+  AllTypeVariant max() const override;
+  size_t bucket_count() const override;
+  double estimate_row_count(ScanType scan_type, const AllTypeVariant& value) const override;
+
+  const std::vector<HistogramBucket<T>>& buckets() const;
+
+ protected:
+  // estimated number of rows with values less than the given one
+  double _estimate_less_than(const T& value) const;
+  double _estimate_equals(const T& value) const;
+
+  // returns the first bucket whose maximum is not smaller than the value
+  typename std::vector<HistogramBucket<T>>::const_iterator _bucket_not_below(const T& value) const;
+
+  std::vector<HistogramBucket<T>> _buckets;
+};
+
+}  // namespace opossum
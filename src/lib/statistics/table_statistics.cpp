@@ -0,0 +1,242 @@
+#include "table_statistics.hpp"
+
+#include <algorithm>
+#include <any>
+#include <memory>
+#include <shared_mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "operators/get_table.hpp"
+#include "operators/pipeline.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "resolve_type.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "storage/value_vector.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// returns the table whose columns the output of the plan has, i.e., the table that it reads
+std::shared_ptr<const Table> base_table(const AbstractOperator& op) {
+  if (const auto get_table = dynamic_cast<const GetTable*>(&op)) {
+    return StorageManager::get().get_table(get_table->table_name());
+  }
+  if (const auto table_wrapper = dynamic_cast<const TableWrapper*>(&op)) return table_wrapper->table();
+  if (const auto table_scan = dynamic_cast<const TableScan*>(&op)) return base_table(*table_scan->input_left());
+  if (const auto pipeline = dynamic_cast<const Pipeline*>(&op)) return base_table(*pipeline->operators().back());
+  Fail("cannot estimate the output of " + op.name());
+  return nullptr;
+}
+
+// the counted ValueIDs of a column of a compressed chunk, which refer to the values in the dictionary of its segment
+template <typename T>
+struct DictionaryValueIdCounts {
+  std::shared_ptr<const ValueVector<T>> dictionary;
+  std::vector<std::pair<ValueID, uint64_t>> value_id_counts;
+};
+
+// the counts of the distinct values of a column of a chunk in ascending order, either as counted values or as counted
+// ValueIDs of a dictionary, which are read without copying them
+template <typename T>
+class SortedValueCounts {
+ public:
+  explicit SortedValueCounts(const std::vector<std::pair<T, uint64_t>>& value_counts) : _value_counts(&value_counts) {}
+  explicit SortedValueCounts(const DictionaryValueIdCounts<T>& value_id_counts) : _value_id_counts(&value_id_counts) {}
+
+  size_t size() const { return _value_counts ? _value_counts->size() : _value_id_counts->value_id_counts.size(); }
+
+  ValueView<T> value(const size_t index) const {
+    if (_value_counts) return (*_value_counts)[index].first;
+    return (*_value_id_counts->dictionary)[_value_id_counts->value_id_counts[index].first];
+  }
+
+  uint64_t count(const size_t index) const {
+    return _value_counts ? (*_value_counts)[index].second : _value_id_counts->value_id_counts[index].second;
+  }
+
+ protected:
+  const std::vector<std::pair<T, uint64_t>>* _value_counts = nullptr;
+  const DictionaryValueIdCounts<T>* _value_id_counts = nullptr;
+};
+
+// merges the sorted counts of the chunks, adding up the counts of values that occur in several chunks
+template <typename T>
+std::vector<std::pair<T, uint64_t>> merge_value_counts(const std::vector<SortedValueCounts<T>>& chunk_value_counts) {
+  // a heap of the next position in the counts of each chunk, ordered so that the smallest value is on top
+  using Position = std::pair<size_t, size_t>;
+  const auto greater = [&](const Position& left, const Position& right) {
+    return chunk_value_counts[right.first].value(right.second) < chunk_value_counts[left.first].value(left.second);
+  };
+  auto heap = std::vector<Position>{};
+  for (auto chunk_index = size_t{0}; chunk_index < chunk_value_counts.size(); ++chunk_index) {
+    if (chunk_value_counts[chunk_index].size() > 0) heap.emplace_back(chunk_index, 0);
+  }
+  std::make_heap(heap.begin(), heap.end(), greater);
+
+  auto merged_value_counts = std::vector<std::pair<T, uint64_t>>{};
+  while (!heap.empty()) {
+    std::pop_heap(heap.begin(), heap.end(), greater);
+    auto& [chunk_index, index] = heap.back();
+    const auto& value_counts = chunk_value_counts[chunk_index];
+    const auto value = value_counts.value(index);
+    if (merged_value_counts.empty() || ValueView<T>{merged_value_counts.back().first} != value) {
+      merged_value_counts.emplace_back(T{value}, 0);
+    }
+    merged_value_counts.back().second += value_counts.count(index);
+
+    if (++index < value_counts.size()) {
+      std::push_heap(heap.begin(), heap.end(), greater);
+    } else {
+      heap.pop_back();
+    }
+  }
+  return merged_value_counts;
+}
+
+// copies the values of a ValueSegment, which rows may be appended to concurrently, so that they can be counted later
+std::shared_ptr<const BaseSegment> copy_value_segment(const std::shared_ptr<const BaseSegment>& segment,
+                                                      const std::string& type) {
+  auto copy = segment;
+  resolve_data_type(type, [&](auto data_type) {
+    using Type = typename decltype(data_type)::type;
+    if (const auto value_segment = std::dynamic_pointer_cast<const ValueSegment<Type>>(segment)) {
+      copy = std::make_shared<ValueSegment<Type>>(ValueVector<Type>{value_segment->values()});
+    }
+  });
+  return copy;
+}
+
+}  // namespace
+
+TableStatistics::TableStatistics(const Table& table, const size_t bucket_count,
+                                 std::shared_ptr<const TableStatistics> previous_statistics)
+    : _table_version(table.version()), _bucket_count(bucket_count) {
+  // The chunks are taken at once, so that chunks that are added concurrently are not counted for some columns only.
+  // Rows are only appended to the last chunk, whose ValueSegments are copied, so that all columns have the same rows.
+  auto chunks = std::vector<std::shared_ptr<const Chunk>>{};
+  auto last_chunk_segments = std::vector<std::shared_ptr<const BaseSegment>>{};
+  {
+    std::shared_lock lock(table._chunk_mutex);
+    chunks.assign(table._chunks.cbegin(), table._chunks.cend());
+    if (!chunks.empty()) {
+      for (ColumnID column_id{0}; column_id < table.column_count(); ++column_id) {
+        last_chunk_segments.push_back(
+            copy_value_segment(chunks.back()->get_segment(column_id), table.column_type(column_id)));
+      }
+    }
+  }
+  if (previous_statistics && previous_statistics->_bucket_count != bucket_count) previous_statistics = nullptr;
+
+  // compressed chunks that have not been replaced since the previous statistics are not counted again
+  _chunk_statistics.resize(chunks.size());
+  auto new_chunk_statistics = std::vector<std::shared_ptr<ChunkStatistics>>(chunks.size());
+  for (ChunkID chunk_id{0}; chunk_id < chunks.size(); ++chunk_id) {
+    if (previous_statistics && chunk_id < previous_statistics->_chunk_statistics.size() &&
+        previous_statistics->_chunk_statistics[chunk_id]->chunk.lock() == chunks[chunk_id]) {
+      _chunk_statistics[chunk_id] = previous_statistics->_chunk_statistics[chunk_id];
+    } else {
+      new_chunk_statistics[chunk_id] = std::make_shared<ChunkStatistics>();
+      new_chunk_statistics[chunk_id]->value_id_counts.reserve(table.column_count());
+      _chunk_statistics[chunk_id] = new_chunk_statistics[chunk_id];
+    }
+  }
+
+  for (ColumnID column_id{0}; column_id < table.column_count(); ++column_id) {
+    resolve_data_type(table.column_type(column_id), [&](auto type) {
+      using Type = typename decltype(type)::type;
+      using ValueIdCounts = DictionaryValueIdCounts<Type>;
+
+      // the counted values of the uncompressed chunks, which are reserved so that sorted_value_counts can refer to them
+      auto value_counts = std::vector<std::vector<std::pair<Type, uint64_t>>>{};
+      value_counts.reserve(chunks.size());
+      auto sorted_value_counts = std::vector<SortedValueCounts<Type>>{};
+      for (ChunkID chunk_id{0}; chunk_id < chunks.size(); ++chunk_id) {
+        const auto& chunk_statistics = new_chunk_statistics[chunk_id];
+        if (!chunk_statistics) {
+          sorted_value_counts.emplace_back(
+              std::any_cast<const ValueIdCounts&>(_chunk_statistics[chunk_id]->value_id_counts[column_id]));
+          continue;
+        }
+
+        const auto segment = chunk_id + 1u == chunks.size() ? last_chunk_segments[column_id]
+                                                            : chunks[chunk_id]->get_segment(column_id);
+        if (const auto dictionary_segment = std::dynamic_pointer_cast<const DictionarySegment<Type>>(segment)) {
+          const auto& value_id_counts = std::any_cast<const ValueIdCounts&>(
+              chunk_statistics->value_id_counts.emplace_back(ValueIdCounts{
+                  dictionary_segment->dictionary(), ColumnStatistics<Type>::count_value_ids(*dictionary_segment)}));
+          sorted_value_counts.emplace_back(value_id_counts);
+          chunk_statistics->column_statistics.push_back(std::make_unique<ColumnStatistics<Type>>(
+              merge_value_counts<Type>({sorted_value_counts.back()}), bucket_count));
+        } else {
+          const auto& chunk_value_counts = value_counts.emplace_back(ColumnStatistics<Type>::count_values(*segment));
+          sorted_value_counts.emplace_back(chunk_value_counts);
+          chunk_statistics->column_statistics.push_back(
+              std::make_unique<ColumnStatistics<Type>>(chunk_value_counts, bucket_count));
+          chunk_statistics->value_id_counts.emplace_back();
+        }
+      }
+
+      _column_statistics.push_back(
+          std::make_unique<ColumnStatistics<Type>>(merge_value_counts(sorted_value_counts), bucket_count));
+    });
+  }
+
+  // only the statistics of chunks whose segments are all compressed can be reused, the others may still change
+  for (ChunkID chunk_id{0}; chunk_id < chunks.size(); ++chunk_id) {
+    const auto& chunk_statistics = new_chunk_statistics[chunk_id];
+    if (!chunk_statistics) continue;
+    if (std::all_of(chunk_statistics->value_id_counts.cbegin(), chunk_statistics->value_id_counts.cend(),
+                    [](const std::any& value_id_counts) { return value_id_counts.has_value(); })) {
+      chunk_statistics->chunk = chunks[chunk_id];
+    } else {
+      chunk_statistics->value_id_counts.clear();
+    }
+  }
+  _row_count = _column_statistics.empty() ? 0 : _column_statistics.front()->row_count();
+}
+
+uint64_t TableStatistics::row_count() const { return _row_count; }
+
+uint64_t TableStatistics::table_version() const { return _table_version; }
+
+const BaseColumnStatistics& TableStatistics::column_statistics(const ColumnID column_id) const {
+  DebugAssert(column_id < _column_statistics.size(), "invalid column id");
+  return *_column_statistics[column_id];
+}
+
+ChunkID TableStatistics::chunk_count() const { return ChunkID(_chunk_statistics.size()); }
+
+const BaseColumnStatistics& TableStatistics::chunk_column_statistics(const ChunkID chunk_id,
+                                                                     const ColumnID column_id) const {
+  DebugAssert(chunk_id < _chunk_statistics.size(), "invalid chunk id");
+  DebugAssert(column_id < _chunk_statistics[chunk_id]->column_statistics.size(), "invalid column id");
+  return *_chunk_statistics[chunk_id]->column_statistics[column_id];
+}
+
+double TableStatistics::estimate_scan_row_count(const ColumnID column_id, const ScanType scan_type,
+                                                const AllTypeVariant& value) const {
+  return column_statistics(column_id).estimate_row_count(scan_type, value);
+}
+
+double TableStatistics::estimate_row_count(const AbstractOperator& op) {
+  if (const auto table_scan = dynamic_cast<const TableScan*>(&op)) {
+    const auto statistics = base_table(op)->table_statistics();
+    return estimate_row_count(*table_scan->input_left()) *
+           statistics->column_statistics(table_scan->column_id())
+               .estimate_selectivity(table_scan->scan_type(), table_scan->search_value());
+  }
+  if (const auto pipeline = dynamic_cast<const Pipeline*>(&op)) {
+    return estimate_row_count(*pipeline->operators().back());
+  }
+  return static_cast<double>(base_table(op)->table_statistics()->row_count());
+}
+
+}  // namespace opossum
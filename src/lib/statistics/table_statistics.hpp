@@ -0,0 +1,70 @@
+#pragma once
+
+#include <any>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "column_statistics.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractOperator;
+class Chunk;
+class Table;
+
+/**
+ * TableStatistics describe the values of each column of a table and of each of its chunks: the number of rows and of
+ * distinct values, the minimum and the maximum, and an equi-depth histogram (see ColumnStatistics). They are used to
+ * estimate the number of rows that a predicate selects, e.g., to choose the order of TableScans.
+ *
+ * The statistics are a snapshot of the table. Table::table_statistics computes them when they are first requested
+ * after the table was changed. For compressed chunks, the values are counted by their ValueIDs, so that only the
+ * uncompressed chunks have to be sorted. As compressed chunks do not change, their statistics and counted ValueIDs are
+ * taken over from the previous statistics of the table, so that only the uncompressed chunks are counted again. The
+ * sorted counts of the chunks are then merged into the statistics of the table.
+ */
+class TableStatistics : private Noncopyable {
+ public:
+  // the statistics of the compressed chunks are reused from the previous statistics if they have the same bucket count
+  explicit TableStatistics(const Table& table, size_t bucket_count = BaseColumnStatistics::DEFAULT_BUCKET_COUNT,
+                           std::shared_ptr<const TableStatistics> previous_statistics = nullptr);
+
+  uint64_t row_count() const;
+
+  // the version of the table from which the statistics were computed (see Table::version)
+  uint64_t table_version() const;
+
+  const BaseColumnStatistics& column_statistics(ColumnID column_id) const;
+
+  ChunkID chunk_count() const;
+  const BaseColumnStatistics& chunk_column_statistics(ChunkID chunk_id, ColumnID column_id) const;
+
+  // returns the estimated number of rows for which "column <scan_type> value" holds
+  double estimate_scan_row_count(ColumnID column_id, ScanType scan_type, const AllTypeVariant& value) const;
+
+  // Returns the estimated number of rows of the output of a plan of GetTable, TableWrapper, TableScan and Pipeline
+  // operators, which does not have to be executed. The predicates of consecutive scans are assumed to be independent.
+  static double estimate_row_count(const AbstractOperator& op);
+
+ protected:
+  // the statistics of the columns of a chunk, which are shared with later statistics of the table if it is compressed
+  struct ChunkStatistics {
+    // the compressed chunk, expired or empty if the chunk has been replaced or is not compressed
+    std::weak_ptr<const Chunk> chunk;
+    std::vector<std::unique_ptr<BaseColumnStatistics>> column_statistics;
+    // the counted ValueIDs of each column of a compressed chunk and the dictionary that they refer to, which is shared
+    // with the segment (see table_statistics.cpp)
+    std::vector<std::any> value_id_counts;
+  };
+
+  const uint64_t _table_version;
+  const size_t _bucket_count;
+  uint64_t _row_count = 0;
+  std::vector<std::unique_ptr<BaseColumnStatistics>> _column_statistics;
+  std::vector<std::shared_ptr<const ChunkStatistics>> _chunk_statistics;
+};
+
+}  // namespace opossum
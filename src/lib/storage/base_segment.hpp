@@ -2,6 +2,7 @@
 
 #include <memory>
 #include <string>
+#include <unordered_set>
 
 #include "all_type_variant.hpp"
 #include "types.hpp"
@@ -28,5 +29,14 @@ class BaseSegment : private Noncopyable {
 
   // returns the number of values
   virtual size_t size() const = 0;
+
+  // returns the estimated number of bytes used by the segment, including the memory of its underlying containers
+  virtual size_t estimate_memory_usage() const = 0;
+
+  // like estimate_memory_usage, but memory that the segment shares with other segments (e.g., a shared dictionary) is
+  // only counted if its address is not in counted_shared_memory yet, to which it is added
+  virtual size_t estimate_memory_usage_deduplicated(std::unordered_set<const void*>& counted_shared_memory) const {
+    return estimate_memory_usage();
+  }
 };
 }  // namespace opossum
@@ -0,0 +1,277 @@
+#include "buffer_manager.hpp"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include "base_segment.hpp"
+#include "chunk.hpp"
+#include "dictionary_segment.hpp"
+#include "operators/export_binary.hpp"
+#include "operators/import_binary.hpp"
+#include "resolve_type.hpp"
+#include "utils/assert.hpp"
+#include "utils/binary_reader.hpp"
+#include "utils/buffered_writer.hpp"
+#include "utils/file_descriptor_guard.hpp"
+#include "utils/mapped_file.hpp"
+#include "utils/size_estimation_utils.hpp"
+#include "utils/tracing.hpp"
+
+namespace opossum {
+
+ChunkBufferState::~ChunkBufferState() {
+  if (!spill_file_name.empty()) {
+    unlink(spill_file_name.c_str());
+  }
+}
+
+BufferManager::BufferManager() : _spill_directory(P_tmpdir) {}
+
+BufferManager& BufferManager::get() {
+  static BufferManager instance;
+  return instance;
+}
+
+void BufferManager::set_memory_budget(size_t bytes) {
+  {
+    std::lock_guard lock(_mutex);
+    _memory_budget = bytes;
+  }
+  enforce_memory_budget();
+}
+
+size_t BufferManager::memory_budget() const {
+  std::lock_guard lock(_mutex);
+  return _memory_budget;
+}
+
+void BufferManager::set_spill_directory(const std::string& directory) {
+  std::lock_guard lock(_mutex);
+  _spill_directory = directory;
+}
+
+size_t BufferManager::resident_memory_usage() const {
+  std::lock_guard lock(_mutex);
+  return _resident_memory_usage_without_locking();
+}
+
+void BufferManager::register_chunk(const std::shared_ptr<Chunk>& chunk, const std::vector<std::string>& column_types) {
+  DebugAssert(!chunk->_buffer_state, "chunk is already managed by the buffer manager");
+  if (memory_budget() == 0 || chunk->size() == 0) return;
+
+  // value segments can still be modified and are therefore not managed
+  auto shared_dictionaries = std::vector<ChunkBufferState::SharedDictionary>(chunk->column_count());
+  auto counted_shared_memory = std::unordered_set<const void*>{};
+  for (ColumnID column_id{0}; column_id < chunk->column_count(); ++column_id) {
+    auto is_dictionary_segment = false;
+    resolve_data_type(column_types[column_id], [&](auto type) {
+      using Type = typename decltype(type)::type;
+      const auto segment = std::dynamic_pointer_cast<DictionarySegment<Type>>(chunk->get_segment(column_id));
+      if (!segment) return;
+      is_dictionary_segment = true;
+
+      // the dictionary is shared if anything besides the segment and this copy refers to it, e.g., the table as the
+      // current dictionary of the column or the segments of other chunks
+      const auto dictionary = segment->dictionary();
+      if (dictionary.use_count() > 2) {
+        shared_dictionaries[column_id] =
+            ChunkBufferState::SharedDictionary{dictionary, sizeof(*dictionary) + vector_heap_size(*dictionary)};
+        counted_shared_memory.insert(dictionary.get());
+      }
+    });
+    if (!is_dictionary_segment) return;
+  }
+
+  auto state = std::make_unique<ChunkBufferState>();
+  state->column_types = column_types;
+  state->size = chunk->size();
+  state->memory_usage = chunk->estimate_memory_usage(counted_shared_memory);
+  state->shared_dictionaries = std::move(shared_dictionaries);
+  chunk->_buffer_state = std::move(state);
+
+  {
+    std::lock_guard lock(_mutex);
+    _chunks.emplace_back(chunk);
+  }
+  enforce_memory_budget();
+}
+
+void BufferManager::enforce_memory_budget() {
+  auto victims = std::vector<std::shared_ptr<Chunk>>{};
+  auto spill_directory = std::string{};
+  {
+    std::lock_guard lock(_mutex);
+    if (_memory_budget == 0) return;
+
+    _chunks.erase(std::remove_if(_chunks.begin(), _chunks.end(), [](const auto& chunk) { return chunk.expired(); }),
+                  _chunks.end());
+    if (_clock_hand >= _chunks.size()) _clock_hand = 0;
+
+    auto memory_usage = _resident_memory_usage_without_locking();
+
+    // every chunk is visited at most twice: the first visit may only clear its reference bit, so that the chunk can be
+    // chosen on the second visit. Chunks that still remain in memory afterwards are pinned or being evicted already.
+    for (auto step = size_t{0}; memory_usage > _memory_budget && step < 2 * _chunks.size(); ++step) {
+      const auto chunk = _chunks[_clock_hand].lock();
+      _clock_hand = (_clock_hand + 1) % _chunks.size();
+      if (!chunk) continue;
+
+      auto& state = *chunk->_buffer_state;
+      if (!state.resident || state.pin_count > 0 || state.evicting) continue;
+      if (state.referenced.exchange(false)) continue;
+
+      state.evicting = true;
+      victims.push_back(chunk);
+      memory_usage -= state.memory_usage;
+    }
+    spill_directory = _spill_directory;
+  }
+
+  // the spill files are written without holding the mutex, so that other threads can register chunks and choose
+  // other victims meanwhile
+  try {
+    for (const auto& chunk : victims) {
+      auto& state = *chunk->_buffer_state;
+      std::unique_lock chunk_lock(state.mutex, std::try_to_lock);
+      // chunks that are being loaded, or have been pinned or accessed since they were chosen, stay in memory
+      if (chunk_lock.owns_lock() && state.resident && state.pin_count == 0 && !state.referenced) {
+        _evict(*chunk, spill_directory);
+      }
+      state.evicting = false;
+    }
+  } catch (...) {
+    for (const auto& chunk : victims) {
+      chunk->_buffer_state->evicting = false;
+    }
+    throw;
+  }
+}
+
+void BufferManager::reset() {
+  auto& buffer_manager = get();
+  std::lock_guard lock(buffer_manager._mutex);
+  buffer_manager._memory_budget = 0;
+  buffer_manager._spill_directory = P_tmpdir;
+  buffer_manager._chunks.clear();
+  buffer_manager._clock_hand = 0;
+}
+
+std::shared_ptr<BaseSegment> BufferManager::_get_segment(const Chunk& chunk, ColumnID column_id) {
+  auto& state = *chunk._buffer_state;
+  state.referenced = true;
+
+  auto segment = std::shared_ptr<BaseSegment>{};
+  auto loaded = false;
+  {
+    std::lock_guard lock(state.mutex);
+    if (!state.resident) {
+      _load(chunk);
+      loaded = true;
+    }
+    // even if the chunk is evicted again, the segment stays alive as long as the caller holds it
+    segment = chunk._segments[column_id];
+  }
+
+  if (loaded) enforce_memory_budget();
+  return segment;
+}
+
+void BufferManager::_pin(const Chunk& chunk) {
+  auto& state = *chunk._buffer_state;
+  state.referenced = true;
+  ++state.pin_count;
+
+  auto loaded = false;
+  {
+    std::lock_guard lock(state.mutex);
+    if (!state.resident) {
+      _load(chunk);
+      loaded = true;
+    }
+  }
+
+  if (loaded) enforce_memory_budget();
+}
+
+void BufferManager::_load(const Chunk& chunk) const {
+  auto& state = *chunk._buffer_state;
+  DebugAssert(!state.resident, "chunk is already in memory");
+  TRACE_SPAN("loading", "load spilled chunk", state.spill_file_name);
+
+  const MappedFile file(state.spill_file_name);
+  BinaryReader reader(file.view());
+
+  chunk._segments.reserve(state.column_types.size());
+  for (ColumnID column_id{0}; column_id < state.column_types.size(); ++column_id) {
+    const auto& column_type = state.column_types[column_id];
+    auto segment = ImportBinary::read_segment(reader, column_type, state.size);
+
+    // segments of shared dictionaries have been spilled without them and use the shared dictionary again
+    const auto& shared_dictionary = state.shared_dictionaries[column_id].dictionary;
+    if (shared_dictionary) {
+      resolve_data_type(column_type, [&](auto type) {
+        using Type = typename decltype(type)::type;
+        const auto attribute_vector = std::static_pointer_cast<DictionarySegment<Type>>(segment)->attribute_vector();
+        segment = std::make_shared<DictionarySegment<Type>>(
+            std::static_pointer_cast<const ValueVector<Type>>(shared_dictionary),
+            std::const_pointer_cast<BaseAttributeVector>(attribute_vector));
+      });
+    }
+    chunk._segments.push_back(std::move(segment));
+  }
+  state.resident = true;
+}
+
+void BufferManager::_evict(const Chunk& chunk, const std::string& spill_directory) {
+  auto& state = *chunk._buffer_state;
+  DebugAssert(state.resident, "chunk has already been evicted");
+  TRACE_SPAN("loading", "evict chunk", state.spill_file_name);
+
+  // managed chunks are immutable, so the spill file only has to be written once
+  if (state.spill_file_name.empty()) {
+    const auto file_name = spill_directory + "/opossum_" + std::to_string(getpid()) + "_" +
+                           std::to_string(_next_spill_file_id++) + ".chunk";
+    const auto file_descriptor = open(file_name.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0600);
+    Assert(file_descriptor >= 0, "BufferManager: Could not create spill file " + file_name);
+    FileDescriptorGuard file_descriptor_guard(file_descriptor);
+
+    BufferedWriter writer(file_descriptor);
+    for (ColumnID column_id{0}; column_id < state.column_types.size(); ++column_id) {
+      ExportBinary::write_segment(chunk._segments[column_id], state.column_types[column_id], writer,
+                                  !state.shared_dictionaries[column_id].dictionary);
+    }
+    writer.flush();
+    Assert(file_descriptor_guard.close() == 0, "BufferManager: Could not close spill file " + file_name);
+    state.spill_file_name = file_name;
+  }
+
+  // swap with an empty vector, so that the capacity is released as well
+  std::vector<std::shared_ptr<BaseSegment>>().swap(chunk._segments);
+  state.resident = false;
+}
+
+size_t BufferManager::_resident_memory_usage_without_locking() const {
+  auto bytes = size_t{0};
+  auto counted_shared_dictionaries = std::unordered_set<const void*>{};
+  for (const auto& weak_chunk : _chunks) {
+    const auto chunk = weak_chunk.lock();
+    if (!chunk) continue;
+
+    const auto& state = *chunk->_buffer_state;
+    if (state.resident) bytes += state.memory_usage;
+    // shared dictionaries stay in memory while their chunks are evicted
+    for (const auto& [dictionary, memory_usage] : state.shared_dictionaries) {
+      if (dictionary && counted_shared_dictionaries.insert(dictionary.get()).second) bytes += memory_usage;
+    }
+  }
+  return bytes;
+}
+
+}  // namespace opossum
@@ -0,0 +1,119 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseSegment;
+class Chunk;
+
+// state that the BufferManager keeps for each chunk it manages
+struct ChunkBufferState : private Noncopyable {
+  // removes the spill file of the chunk, if it was ever evicted
+  ~ChunkBufferState();
+
+  // protects resident, spill_file_name and the segments of the chunk
+  std::mutex mutex;
+
+  std::atomic<bool> resident{true};
+  std::atomic<bool> referenced{true};
+  std::atomic<uint32_t> pin_count{0};
+  // set while the chunk has been chosen for eviction, so that other threads do not choose it as well
+  std::atomic<bool> evicting{false};
+
+  // a dictionary that the chunk shares with other segments, e.g., with DictionaryScope::Column
+  struct SharedDictionary {
+    // std::shared_ptr<const ValueVector<T>>, nullptr if the dictionary of the column is not shared
+    std::shared_ptr<const void> dictionary;
+    size_t memory_usage = 0;
+  };
+
+  // the chunk does not change once it is managed, so that these do not have to be read from the (possibly evicted)
+  // segments
+  std::vector<std::string> column_types;
+  uint32_t size = 0;
+  // the memory that is freed when the chunk is evicted, i.e., without the shared dictionaries
+  size_t memory_usage = 0;
+  // shared dictionaries stay in memory while the chunk is evicted, they are not written to the spill file and the
+  // reloaded segments use them again
+  std::vector<SharedDictionary> shared_dictionaries;
+
+  // empty until the chunk is evicted for the first time, afterwards the file is reused for further evictions
+  std::string spill_file_name;
+};
+
+// The BufferManager is a singleton that keeps the memory used by immutable (i.e., dictionary-encoded) chunks within a
+// budget. If the budget is exceeded, the segments of chunks that have not been used recently are written to a spill
+// file and freed. The Chunk objects themselves stay in their tables, so that references to them remain valid, and
+// their segments are loaded again when they are accessed through Chunk::get_segment.
+//
+// Dictionaries that are shared by the segments of several chunks (see DictionaryScope::Column) are not spilled, as
+// evicting one of the chunks would not free them. They are counted once towards the memory budget.
+//
+// Victims are chosen with the CLOCK algorithm: each access sets a reference bit, which gives the chunk a second chance
+// when the clock hand passes it. Chunks that are pinned (e.g., by an operator that is scanning them) are never evicted.
+//
+// The buffer manager is disabled by default. Only chunks that are compressed or added to a table while a memory
+// budget is set are managed.
+class BufferManager : private Noncopyable {
+ public:
+  static BufferManager& get();
+
+  // sets the number of bytes that the managed chunks may use in memory, 0 disables the buffer manager
+  // if the new budget is exceeded, chunks are evicted immediately
+  void set_memory_budget(size_t bytes);
+  size_t memory_budget() const;
+
+  // sets the directory in which the spill files are created, defaults to the temporary directory of the system
+  void set_spill_directory(const std::string& directory);
+
+  // returns the estimated number of bytes used by the managed chunks that are currently in memory
+  size_t resident_memory_usage() const;
+
+  // hands a chunk over to the buffer manager if a memory budget is set and all of its segments are
+  // dictionary-encoded; other chunks are ignored
+  // called by the Table whenever a chunk becomes immutable
+  void register_chunk(const std::shared_ptr<Chunk>& chunk, const std::vector<std::string>& column_types);
+
+  // evicts unpinned chunks until the resident chunks fit into the memory budget again, or no chunk can be evicted
+  void enforce_memory_budget();
+
+  // disables the buffer manager and forgets all managed chunks
+  // chunks that have already been evicted are still loaded when they are accessed
+  static void reset();
+
+ protected:
+  friend class Chunk;
+
+  BufferManager();
+
+  // called by Chunk::get_segment for managed chunks
+  std::shared_ptr<BaseSegment> _get_segment(const Chunk& chunk, ColumnID column_id);
+
+  // called by Chunk::pin for managed chunks
+  void _pin(const Chunk& chunk);
+
+  // load or evict the segments of a chunk, the caller has to hold the mutex of the chunk's buffer state, but not _mutex
+  void _load(const Chunk& chunk) const;
+  void _evict(const Chunk& chunk, const std::string& spill_directory);
+
+  size_t _resident_memory_usage_without_locking() const;
+
+  mutable std::mutex _mutex;
+
+  size_t _memory_budget = 0;
+  std::string _spill_directory;
+  std::atomic<uint64_t> _next_spill_file_id{0};
+
+  // all managed chunks in the order of the clock, chunks of dropped tables expire and are removed lazily
+  std::vector<std::weak_ptr<Chunk>> _chunks;
+  size_t _clock_hand = 0;
+};
+
+}  // namespace opossum
@@ -4,17 +4,28 @@
 #include <memory>
 #include <mutex>
 #include <string>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
 #include "base_segment.hpp"
+#include "buffer_manager.hpp"
 #include "chunk.hpp"
 
 #include "utils/assert.hpp"
 
 namespace opossum {
 
-void Chunk::add_segment(std::shared_ptr<BaseSegment> segment) { _segments.push_back(segment); }
+// defined here, because ChunkBufferState is incomplete in the header
+Chunk::Chunk() = default;
+Chunk::~Chunk() = default;
+Chunk::Chunk(Chunk&&) = default;
+Chunk& Chunk::operator=(Chunk&&) = default;
+
+void Chunk::add_segment(std::shared_ptr<BaseSegment> segment) {
+  DebugAssert(!_buffer_state, "chunks managed by the buffer manager are immutable");
+  _segments.push_back(segment);
+}
 
 void Chunk::append(const std::vector<AllTypeVariant>& values) {
   DebugAssert(values.size() == _segments.size(), "wrong number of items in passed row");
@@ -23,13 +34,53 @@ void Chunk::append(const std::vector<AllTypeVariant>& values) {
   }
 }
 
-std::shared_ptr<BaseSegment> Chunk::get_segment(ColumnID column_id) const { return _segments[column_id]; }
+std::shared_ptr<BaseSegment> Chunk::get_segment(ColumnID column_id) const {
+  if (_buffer_state) return BufferManager::get()._get_segment(*this, column_id);
+  return _segments[column_id];
+}
 
-uint16_t Chunk::column_count() const { return _segments.size(); }
+uint16_t Chunk::column_count() const {
+  if (_buffer_state) return _buffer_state->column_types.size();
+  return _segments.size();
+}
 
 uint32_t Chunk::size() const {
+  if (_buffer_state) return _buffer_state->size;
   if (column_count() > 0) return _segments[0]->size();
   return 0;
 }
 
+size_t Chunk::estimate_memory_usage() const {
+  auto counted_shared_memory = std::unordered_set<const void*>{};
+  return estimate_memory_usage(counted_shared_memory);
+}
+
+size_t Chunk::estimate_memory_usage(std::unordered_set<const void*>& counted_shared_memory) const {
+  // prevents the segments from being evicted or loaded while they are counted
+  auto lock = std::unique_lock<std::mutex>{};
+  if (_buffer_state) lock = std::unique_lock(_buffer_state->mutex);
+
+  auto bytes = sizeof(*this) + _segments.capacity() * sizeof(std::shared_ptr<BaseSegment>);
+  for (const auto& segment : _segments) {
+    bytes += segment->estimate_memory_usage_deduplicated(counted_shared_memory);
+  }
+  return bytes;
+}
+
+void Chunk::pin() const {
+  if (_buffer_state) BufferManager::get()._pin(*this);
+}
+
+void Chunk::unpin() const {
+  if (!_buffer_state) return;
+  DebugAssert(_buffer_state->pin_count > 0, "chunk is not pinned");
+  --_buffer_state->pin_count;
+}
+
+bool Chunk::is_resident() const { return !_buffer_state || _buffer_state->resident; }
+
+NodeID Chunk::node_id() const { return _node_id; }
+
+void Chunk::set_node_id(const NodeID node_id) { _node_id = node_id; }
+
 }  // namespace opossum
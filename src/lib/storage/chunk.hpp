@@ -6,6 +6,7 @@
 #include <atomic>
 #include <memory>
 #include <string>
+#include <unordered_set>
 #include <vector>
 
 #include "all_type_variant.hpp"
@@ -15,6 +16,7 @@ namespace opossum {
 
 class BaseIndex;
 class BaseSegment;
+struct ChunkBufferState;
 
 // A chunk is a horizontal partition of a table.
 // For each column in the table, it holds one segment. The segments across all chunks constitute the column.
@@ -22,12 +24,13 @@ class BaseSegment;
 // Find more information about this in our wiki: https://github.com/hyrise/hyrise/wiki/chunk-concept
 class Chunk : private Noncopyable {
  public:
-  Chunk() = default;
+  Chunk();
+  ~Chunk();
 
   // we need to explicitly set the move constructor to default when
   // we overwrite the copy constructor
-  Chunk(Chunk&&) = default;
-  Chunk& operator=(Chunk&&) = default;
+  Chunk(Chunk&&);
+  Chunk& operator=(Chunk&&);
 
   // adds a segment to the "right" of the chunk
   void add_segment(std::shared_ptr<BaseSegment> segment);
@@ -43,11 +46,51 @@ class Chunk : private Noncopyable {
   void append(const std::vector<AllTypeVariant>& values);
 
   // Returns the segment at a given position
+  // if the BufferManager has evicted the segments of the chunk, they are loaded from disk first
   std::shared_ptr<BaseSegment> get_segment(ColumnID column_id) const;
 
+  // returns the estimated number of bytes used by the chunk and all of its segments that are in memory
+  size_t estimate_memory_usage() const;
+
+  // like estimate_memory_usage, but memory shared with other segments is only counted once (see BaseSegment), e.g.,
+  // to count the dictionaries shared by the chunks of a table once
+  size_t estimate_memory_usage(std::unordered_set<const void*>& counted_shared_memory) const;
+
+  // pinned chunks are not evicted by the BufferManager, pins are counted and each pin() needs a matching unpin()
+  // if the chunk has already been evicted, pin() loads it
+  // for chunks that are not managed by the BufferManager, these are no-ops
+  void pin() const;
+  void unpin() const;
+
+  // returns false if the segments of the chunk are currently evicted to disk
+  bool is_resident() const;
+
+  // the NUMA node on which the segments of the chunk have been allocated, UNKNOWN_NODE_ID if they were not placed
+  // explicitly (see Topology)
+  NodeID node_id() const;
+  void set_node_id(const NodeID node_id);
+
  protected:
+  friend class BufferManager;
+
   // holds pointers to segments
-  std::vector<std::shared_ptr<BaseSegment>> _segments;
+  // mutable, because the BufferManager evicts and loads the segments of chunks that are accessed as const
+  mutable std::vector<std::shared_ptr<BaseSegment>> _segments;
+
+  // set once the chunk is managed by the BufferManager
+  std::unique_ptr<ChunkBufferState> _buffer_state;
+
+  NodeID _node_id = UNKNOWN_NODE_ID;
+};
+
+// pins a chunk for as long as it exists, e.g., while an operator works on the chunk's segments
+class ChunkPin : private Noncopyable {
+ public:
+  explicit ChunkPin(const Chunk& chunk) : _chunk(chunk) { _chunk.pin(); }
+  ~ChunkPin() { _chunk.unpin(); }
+
+ protected:
+  const Chunk& _chunk;
 };
 
 }  // namespace opossum
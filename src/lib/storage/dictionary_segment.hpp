@@ -1,5 +1,7 @@
 #pragma once
 
+#include <algorithm>
+#include <functional>
 #include <limits>
 #include <memory>
 #include <set>
@@ -14,7 +16,9 @@
 #include "types.hpp"
 #include "utils/assert.hpp"
 #include "utils/performance_warning.hpp"
+#include "utils/size_estimation_utils.hpp"
 #include "value_segment.hpp"
+#include "value_vector.hpp"
 
 namespace opossum {
 
@@ -26,53 +30,119 @@ class BaseSegment;
 constexpr ValueID INVALID_VALUE_ID{std::numeric_limits<ValueID::base_type>::max()};
 
 // Dictionary is a specific segment type that stores all its values in a vector
+// the dictionary of a string segment is a StringVector, i.e., its strings are stored contiguously
 template <typename T>
 class DictionarySegment : public BaseSegment {
  public:
   /**
    * Creates a Dictionary segment from a given value segment.
+   * The dictionary and the attribute vector are allocated using the given allocator.
    */
-  explicit DictionarySegment(const std::shared_ptr<BaseSegment>& base_segment)
-      : _dictionary(std::make_shared<std::vector<T>>()) {
+  explicit DictionarySegment(const std::shared_ptr<BaseSegment>& base_segment,
+                             const PolymorphicAllocator<T>& allocator = {})
+      : DictionarySegment(base_segment, nullptr, allocator) {}
+
+  /**
+   * Creates a Dictionary segment from a given value segment, using a sorted dictionary that is shared with other
+   * segments of the same column (see DictionaryScope::Column). Shared dictionaries are never modified: if the value
+   * segment contains values that are missing from it, they are merged into a new dictionary, which the following
+   * segments of the column should share instead (see dictionary()). As long as no new values occur, all segments
+   * use the same dictionary and their ValueIDs can be compared directly.
+   */
+  DictionarySegment(const std::shared_ptr<BaseSegment>& base_segment,
+                    std::shared_ptr<const ValueVector<T>> shared_dictionary,
+                    const PolymorphicAllocator<T>& allocator = {}) {
     DebugAssert(base_segment->size() <= std::numeric_limits<ChunkOffset>::max(), "too many values in a segment");
     const auto value_segment = std::dynamic_pointer_cast<ValueSegment<T>>(base_segment);
     DebugAssert(value_segment != nullptr, "expected to get a value segment");
-
-    // initialize dictionary
-    auto unique_values = std::set<T>();
-    for (const auto& value : value_segment->values()) {
-      unique_values.insert(value);
+    const auto& values = value_segment->values();
+
+    // collect the values that the shared dictionary (if any) does not contain yet
+    // the transparent comparator allows looking up the string_views of string segments without copying them
+    auto new_values = std::set<T, std::less<>>();
+    for (const auto& value : values) {
+      if (!shared_dictionary ||
+          !std::binary_search(shared_dictionary->cbegin(), shared_dictionary->cend(), ValueView<T>{value})) {
+        new_values.emplace(value);
+      }
     }
 
-    const auto num_unique_elements = unique_values.size();
-    _dictionary->reserve(num_unique_elements);
-    for (const auto& unique_value : unique_values) {
-      _dictionary->push_back(unique_value);
+    if (!shared_dictionary) {
+      _dictionary = merge_dictionaries(ValueVector<T>{}, new_values, allocator);
+    } else if (!new_values.empty()) {
+      _dictionary = merge_dictionaries(*shared_dictionary, new_values, allocator);
+    } else {
+      _dictionary = std::move(shared_dictionary);
     }
 
-    // initialize attribute vector
-    if (num_unique_elements <= std::numeric_limits<uint8_t>::max()) {
-      _initialize_attribute_vector<uint8_t>(value_segment, unique_values);
-    } else if (num_unique_elements <= std::numeric_limits<uint16_t>::max()) {
-      _initialize_attribute_vector<uint16_t>(value_segment, unique_values);
-    } else if (num_unique_elements <= std::numeric_limits<uint32_t>::max()) {
-      _initialize_attribute_vector<uint32_t>(value_segment, unique_values);
+    _initialize_attribute_vector(
+        values.size(),
+        [&](const ChunkOffset chunk_offset) {
+          const auto value = ValueView<T>{values[chunk_offset]};
+          const auto position = std::lower_bound(_dictionary->cbegin(), _dictionary->cend(), value);
+          DebugAssert(position != _dictionary->cend() && *position == value,
+                      "The value " + type_cast<std::string>(T{value}) + " is not in the dictionary");
+          return ValueID(std::distance(_dictionary->cbegin(), position));
+        },
+        allocator);
+  }
+
+  /**
+   * Re-encodes a Dictionary segment using another dictionary, which has to contain all values of the segment, e.g.,
+   * to let segments that were encoded with different versions of a column's shared dictionary share the latest one.
+   */
+  DictionarySegment(const DictionarySegment<T>& segment, std::shared_ptr<const ValueVector<T>> dictionary,
+                    const PolymorphicAllocator<T>& allocator = {})
+      : _dictionary(std::move(dictionary)) {
+    DebugAssert(std::is_sorted(_dictionary->cbegin(), _dictionary->cend()), "dictionary has to be sorted");
+
+    // translates the ValueIDs of the segment, so that each dictionary entry has to be looked up only once
+    auto new_value_ids = std::vector<ValueID>();
+    new_value_ids.reserve(segment.unique_values_count());
+    for (const auto& value : *segment._dictionary) {
+      const auto position = std::lower_bound(_dictionary->cbegin(), _dictionary->cend(), value);
+      DebugAssert(position != _dictionary->cend() && *position == value,
+                  "The value " + type_cast<std::string>(T{value}) + " is not in the dictionary");
+      new_value_ids.push_back(ValueID(std::distance(_dictionary->cbegin(), position)));
     }
+
+    const auto& attribute_vector = *segment._attribute_vector;
+    _initialize_attribute_vector(
+        attribute_vector.size(),
+        [&](const ChunkOffset chunk_offset) { return new_value_ids[attribute_vector.get(chunk_offset)]; }, allocator);
+  }
+
+  /**
+   * Creates a Dictionary segment from an already sorted dictionary and a matching attribute vector,
+   * e.g., when importing a table that has been exported in a binary format.
+   */
+  DictionarySegment(std::shared_ptr<const ValueVector<T>> dictionary,
+                    std::shared_ptr<BaseAttributeVector> attribute_vector)
+      : _dictionary(std::move(dictionary)), _attribute_vector(std::move(attribute_vector)) {
+    DebugAssert(std::is_sorted(_dictionary->cbegin(), _dictionary->cend()), "dictionary has to be sorted");
   }
 
-  template <typename S>
-  void _initialize_attribute_vector(const std::shared_ptr<ValueSegment<T>>& value_segment,
-                                    const std::set<T>& unique_values) {
-    std::vector<S> attributes;
-    attributes.reserve(value_segment->size());
-
-    for (const auto& value : value_segment->values()) {
-      const auto set_pos = static_cast<ValueID>(std::distance(unique_values.cbegin(), unique_values.find(value)));
-      DebugAssert(set_pos < unique_values.size(),
-                  "The value " + type_cast<std::string>(value) + " is not in the dictionary");
-      attributes.push_back(set_pos);
+  // returns a new sorted dictionary that contains the values of both sorted (and duplicate-free) ranges
+  template <typename Left, typename Right>
+  static std::shared_ptr<ValueVector<T>> merge_dictionaries(const Left& left, const Right& right,
+                                                            const PolymorphicAllocator<T>& allocator = {}) {
+    // the polymorphic allocator passes itself on to the vector (uses-allocator construction)
+    auto dictionary = std::allocate_shared<ValueVector<T>>(allocator);
+    dictionary->reserve(left.size() + right.size());
+
+    auto left_it = left.cbegin();
+    auto right_it = right.cbegin();
+    while (left_it != left.cend() || right_it != right.cend()) {
+      if (right_it == right.cend() || (left_it != left.cend() && ValueView<T>{*left_it} < ValueView<T>{*right_it})) {
+        dictionary->push_back(*left_it++);
+      } else if (left_it == left.cend() || ValueView<T>{*right_it} < ValueView<T>{*left_it}) {
+        dictionary->push_back(*right_it++);
+      } else {
+        dictionary->push_back(*left_it++);
+        ++right_it;
+      }
     }
-    _attribute_vector = std::make_shared<FittedAttributeVector<S>>(std::move(attributes));
+    return dictionary;
   }
 
   // SEMINAR INFORMATION: Since most of these methods depend on the template parameter, you will have to implement
@@ -84,20 +154,21 @@ class DictionarySegment : public BaseSegment {
   // return the value at a certain position.
   const T get(const size_t index) const {
     DebugAssert(index < _attribute_vector->size(), "invalid index");
-    return (*_dictionary)[(*_attribute_vector).get(index)];
+    return T{(*_dictionary)[(*_attribute_vector).get(index)]};
   }
 
   // dictionary segments are immutable
   void append(const AllTypeVariant&) override { Fail("dictionary segments are immutable"); }
 
   // returns an underlying dictionary
-  std::shared_ptr<const std::vector<T>> dictionary() const { return _dictionary; }
+  std::shared_ptr<const ValueVector<T>> dictionary() const { return _dictionary; }
 
   // returns an underlying data structure
   std::shared_ptr<const BaseAttributeVector> attribute_vector() const { return _attribute_vector; }
 
   // return the value represented by a given ValueID
-  const T& value_by_value_id(ValueID value_id) const {
+  // for strings, the returned view points into the dictionary
+  ValueView<T> value_by_value_id(ValueID value_id) const {
     DebugAssert(value_id != INVALID_VALUE_ID && value_id < _dictionary->size(), "invalid value id");
     return (*_dictionary)[value_id];
   }
@@ -134,8 +205,49 @@ class DictionarySegment : public BaseSegment {
   // return the number of entries
   size_t size() const override { return _attribute_vector->size(); }
 
+  // includes the dictionary (and the heap allocations of its strings) as well as the attribute vector
+  // a dictionary that is shared by several segments is counted for each of them
+  size_t estimate_memory_usage() const override {
+    return sizeof(*this) + sizeof(*_dictionary) + vector_heap_size(*_dictionary) +
+           _attribute_vector->estimate_memory_usage();
+  }
+
+  // a shared dictionary is counted only for the first of its segments
+  size_t estimate_memory_usage_deduplicated(std::unordered_set<const void*>& counted_shared_memory) const override {
+    auto bytes = sizeof(*this) + _attribute_vector->estimate_memory_usage();
+    if (counted_shared_memory.insert(_dictionary.get()).second) {
+      bytes += sizeof(*_dictionary) + vector_heap_size(*_dictionary);
+    }
+    return bytes;
+  }
+
  protected:
-  std::shared_ptr<std::vector<T>> _dictionary;
+  // creates an attribute vector of the smallest width that fits the dictionary
+  template <typename Function>
+  void _initialize_attribute_vector(const size_t size, const Function& value_id_at,
+                                    const PolymorphicAllocator<T>& allocator) {
+    const auto unique_values_count = _dictionary->size();
+    if (unique_values_count <= std::numeric_limits<uint8_t>::max()) {
+      _initialize_attribute_vector<uint8_t>(size, value_id_at, allocator);
+    } else if (unique_values_count <= std::numeric_limits<uint16_t>::max()) {
+      _initialize_attribute_vector<uint16_t>(size, value_id_at, allocator);
+    } else {
+      _initialize_attribute_vector<uint32_t>(size, value_id_at, allocator);
+    }
+  }
+
+  template <typename S, typename Function>
+  void _initialize_attribute_vector(const size_t size, const Function& value_id_at,
+                                    const PolymorphicAllocator<T>& allocator) {
+    auto attributes = pmr_vector<S>(allocator);
+    attributes.reserve(size);
+    for (ChunkOffset chunk_offset{0}; chunk_offset < size; ++chunk_offset) {
+      attributes.push_back(static_cast<S>(value_id_at(chunk_offset)));
+    }
+    _attribute_vector = std::allocate_shared<FittedAttributeVector<S>>(allocator, std::move(attributes));
+  }
+
+  std::shared_ptr<const ValueVector<T>> _dictionary;
   std::shared_ptr<BaseAttributeVector> _attribute_vector;
 };
 
@@ -6,13 +6,14 @@
 
 #include "base_attribute_vector.hpp"
 #include "utils/assert.hpp"
+#include "utils/size_estimation_utils.hpp"
 
 namespace opossum {
 
 template <typename T>
 class FittedAttributeVector : public BaseAttributeVector {
  public:
-  explicit FittedAttributeVector(std::vector<T>&& values) : _values(std::move(values)) {}
+  explicit FittedAttributeVector(pmr_vector<T>&& values) : _values(std::move(values)) {}
   ~FittedAttributeVector() = default;
 
   ValueID get(const size_t offset) const override {
@@ -30,10 +31,12 @@ class FittedAttributeVector : public BaseAttributeVector {
 
   AttributeVectorWidth width() const override { return sizeof(T); }
 
-  const std::vector<T>& values() const { return _values; }
+  size_t estimate_memory_usage() const override { return sizeof(*this) + vector_heap_size(_values); }
+
+  const pmr_vector<T>& values() const { return _values; }
 
  protected:
-  std::vector<T> _values;
+  pmr_vector<T> _values;
 };
 
 }  // namespace opossum
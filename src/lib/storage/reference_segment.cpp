@@ -3,6 +3,7 @@
 #include <memory>
 
 #include "utils/performance_warning.hpp"
+#include "utils/size_estimation_utils.hpp"
 
 namespace opossum {
 
@@ -10,17 +11,69 @@ ReferenceSegment::ReferenceSegment(const std::shared_ptr<const Table> referenced
                                    const ColumnID referenced_column_id, const std::shared_ptr<const PosList> pos)
     : _referenced_table{referenced_table}, _referenced_column_id{referenced_column_id}, _pos_list{pos} {}
 
+ReferenceSegment::ReferenceSegment(const std::shared_ptr<const Table> referenced_table,
+                                   const ColumnID referenced_column_id, const ChunkID referenced_chunk_id,
+                                   const std::shared_ptr<const ChunkOffsetList> chunk_offsets)
+    : _referenced_table{referenced_table},
+      _referenced_column_id{referenced_column_id},
+      _referenced_chunk_id{referenced_chunk_id},
+      _chunk_offsets{chunk_offsets} {
+  DebugAssert(referenced_chunk_id < referenced_table->chunk_count(), "invalid chunk id");
+}
+
+ReferenceSegment::ReferenceSegment(const std::shared_ptr<const Table> referenced_table,
+                                   const ColumnID referenced_column_id, const ChunkID referenced_chunk_id,
+                                   const std::shared_ptr<const SelectionBitmap> selection_bitmap)
+    : _referenced_table{referenced_table},
+      _referenced_column_id{referenced_column_id},
+      _referenced_chunk_id{referenced_chunk_id},
+      _selection_bitmap{selection_bitmap} {
+  DebugAssert(referenced_chunk_id < referenced_table->chunk_count(), "invalid chunk id");
+  DebugAssert(selection_bitmap->chunk_size() == referenced_table->get_chunk(referenced_chunk_id).size(),
+              "selection bitmap does not match the referenced chunk");
+}
+
 const AllTypeVariant ReferenceSegment::operator[](const size_t offset) const {
   PerformanceWarning("operator[] used");
-  const RowID row_id = _pos_list->operator[](offset);
+  const auto row_id = this->row_id(offset);
   const auto& chunk = _referenced_table->get_chunk(row_id.chunk_id);
   const auto segment = chunk.get_segment(_referenced_column_id);
   return segment->operator[](row_id.chunk_offset);
 }
 
-size_t ReferenceSegment::size() const { return _pos_list->size(); }
+size_t ReferenceSegment::size() const {
+  if (_chunk_offsets) return _chunk_offsets->size();
+  if (_selection_bitmap) return _selection_bitmap->size();
+  return _pos_list->size();
+}
+
+size_t ReferenceSegment::estimate_memory_usage() const {
+  if (_chunk_offsets) return sizeof(*this) + sizeof(*_chunk_offsets) + vector_heap_size(*_chunk_offsets);
+  if (_selection_bitmap) return sizeof(*this) + _selection_bitmap->estimate_memory_usage();
+  return sizeof(*this) + sizeof(*_pos_list) + vector_heap_size(*_pos_list);
+}
 
-const std::shared_ptr<const PosList> ReferenceSegment::pos_list() const { return _pos_list; }
+bool ReferenceSegment::references_single_chunk() const { return _pos_list == nullptr; }
+
+const std::shared_ptr<const PosList> ReferenceSegment::pos_list() const {
+  DebugAssert(!references_single_chunk(), "the segment stores chunk offsets instead of a position list");
+  return _pos_list;
+}
+
+ChunkID ReferenceSegment::referenced_chunk_id() const {
+  DebugAssert(references_single_chunk(), "the segment does not reference a single chunk");
+  return _referenced_chunk_id;
+}
+
+const std::shared_ptr<const ChunkOffsetList> ReferenceSegment::chunk_offsets() const {
+  DebugAssert(references_single_chunk(), "the segment does not reference a single chunk");
+  return _chunk_offsets;
+}
+
+const std::shared_ptr<const SelectionBitmap> ReferenceSegment::selection_bitmap() const {
+  DebugAssert(references_single_chunk(), "the segment does not reference a single chunk");
+  return _selection_bitmap;
+}
 
 const std::shared_ptr<const Table> ReferenceSegment::referenced_table() const { return _referenced_table; }
 
@@ -9,10 +9,12 @@
 
 #include "base_segment.hpp"
 #include "dictionary_segment.hpp"
+#include "selection_bitmap.hpp"
 #include "table.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
 #include "value_segment.hpp"
+#include "value_vector.hpp"
 
 namespace opossum {
 
@@ -24,21 +26,101 @@ class ReferenceSegment : public BaseSegment {
   ReferenceSegment(const std::shared_ptr<const Table> referenced_table, const ColumnID referenced_column_id,
                    const std::shared_ptr<const PosList> pos);
 
+  // creates a reference segment whose positions all lie within one chunk of the referenced table, so that only their
+  // offsets within that chunk are stored
+  ReferenceSegment(const std::shared_ptr<const Table> referenced_table, const ColumnID referenced_column_id,
+                   const ChunkID referenced_chunk_id, const std::shared_ptr<const ChunkOffsetList> chunk_offsets);
+
+  // creates a reference segment for the selected rows of one chunk of the referenced table, in ascending order
+  ReferenceSegment(const std::shared_ptr<const Table> referenced_table, const ColumnID referenced_column_id,
+                   const ChunkID referenced_chunk_id, const std::shared_ptr<const SelectionBitmap> selection_bitmap);
+
   const AllTypeVariant operator[](const size_t i) const override;
 
   void append(const AllTypeVariant&) override { Fail("ReferenceSegment is immutable"); };
 
   size_t size() const override;
 
+  // Includes the positions, even though they are usually shared with the other ReferenceSegments of the chunk.
+  // The referenced table is not included.
+  size_t estimate_memory_usage() const override;
+
+  // returns whether the positions lie within a single chunk, i.e., are stored as chunk offsets or a selection bitmap
+  bool references_single_chunk() const;
+
+  // returns the referenced row at the given offset, regardless of how the positions are stored
+  // finding a row in a selection bitmap involves a binary search, so prefer for_each_row_id to iterate over the rows
+  RowID row_id(const size_t offset) const {
+    if (_chunk_offsets) return RowID{_referenced_chunk_id, (*_chunk_offsets)[offset]};
+    if (_selection_bitmap) return RowID{_referenced_chunk_id, (*_selection_bitmap)[offset]};
+    return (*_pos_list)[offset];
+  }
+
+  // calls function(row_id) for all referenced rows in the order of the segment
+  template <typename Function>
+  void for_each_row_id(const Function& function) const {
+    if (_chunk_offsets) {
+      for (const auto chunk_offset : *_chunk_offsets) function(RowID{_referenced_chunk_id, chunk_offset});
+    } else if (_selection_bitmap) {
+      _selection_bitmap->for_each(
+          [&](const ChunkOffset chunk_offset) { function(RowID{_referenced_chunk_id, chunk_offset}); });
+    } else {
+      for (const auto& row_id : *_pos_list) function(row_id);
+    }
+  }
+
+  // only available if the segment does not reference a single chunk
   const std::shared_ptr<const PosList> pos_list() const;
+
+  // only available if the segment references a single chunk
+  // exactly one of chunk_offsets() and selection_bitmap() is set for these segments
+  ChunkID referenced_chunk_id() const;
+  const std::shared_ptr<const ChunkOffsetList> chunk_offsets() const;
+  const std::shared_ptr<const SelectionBitmap> selection_bitmap() const;
+
   const std::shared_ptr<const Table> referenced_table() const;
 
   ColumnID referenced_column_id() const;
 
+  // Returns the referenced values in the order of the position list. In contrast to operator[], this does not box
+  // every value in an AllTypeVariant. T has to match the type of the referenced column.
+  template <typename T>
+  ValueVector<T> materialize_values(const PolymorphicAllocator<T>& allocator = {}) const {
+    auto values = ValueVector<T>(allocator);
+    values.reserve(size());
+
+    // consecutive positions usually point into the same chunk, so we only resolve the segment when the chunk changes
+    auto current_chunk_id = INVALID_CHUNK_ID;
+    auto value_segment = std::shared_ptr<const ValueSegment<T>>{};
+    auto dictionary_segment = std::shared_ptr<const DictionarySegment<T>>{};
+
+    for_each_row_id([&](const RowID& row_id) {
+      if (row_id.chunk_id != current_chunk_id) {
+        current_chunk_id = row_id.chunk_id;
+        const auto segment = _referenced_table->get_chunk(row_id.chunk_id).get_segment(_referenced_column_id);
+        value_segment = std::dynamic_pointer_cast<const ValueSegment<T>>(segment);
+        dictionary_segment = std::dynamic_pointer_cast<const DictionarySegment<T>>(segment);
+        Assert(value_segment || dictionary_segment, "referenced segment has an unexpected type");
+      }
+
+      if (value_segment) {
+        values.push_back(value_segment->values()[row_id.chunk_offset]);
+      } else {
+        values.push_back(dictionary_segment->get(row_id.chunk_offset));
+      }
+    });
+    return values;
+  }
+
  protected:
   std::shared_ptr<const Table> _referenced_table;
   ColumnID _referenced_column_id;
+
+  // either _pos_list or _referenced_chunk_id and one of _chunk_offsets and _selection_bitmap are set
   std::shared_ptr<const PosList> _pos_list;
+  ChunkID _referenced_chunk_id = INVALID_CHUNK_ID;
+  std::shared_ptr<const ChunkOffsetList> _chunk_offsets;
+  std::shared_ptr<const SelectionBitmap> _selection_bitmap;
 };
 
 }  // namespace opossum
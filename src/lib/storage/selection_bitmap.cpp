@@ -0,0 +1,59 @@
+#include "selection_bitmap.hpp"
+
+#include <algorithm>
+#include <utility>
+
+#include "utils/assert.hpp"
+#include "utils/size_estimation_utils.hpp"
+
+namespace opossum {
+
+bool SelectionBitmap::is_smaller_than_chunk_offsets(size_t selected_count, ChunkOffset chunk_size) {
+  const auto bitmap_size = word_count(chunk_size) * (sizeof(uint64_t) + sizeof(uint32_t));
+  return bitmap_size < selected_count * sizeof(ChunkOffset);
+}
+
+SelectionBitmap::SelectionBitmap(pmr_vector<uint64_t>&& words, ChunkOffset chunk_size)
+    : _words(std::move(words)), _ranks(_words.get_allocator()), _chunk_size(chunk_size) {
+  DebugAssert(_words.size() == word_count(chunk_size), "number of words does not match the chunk size");
+  DebugAssert(chunk_size % BITS_PER_WORD == 0 || _words.back() >> (chunk_size % BITS_PER_WORD) == 0,
+              "rows beyond the end of the chunk must not be selected");
+
+  _ranks.reserve(_words.size());
+  for (const auto word : _words) {
+    _ranks.push_back(static_cast<uint32_t>(_size));
+    _size += __builtin_popcountll(word);
+  }
+}
+
+size_t SelectionBitmap::size() const { return _size; }
+
+ChunkOffset SelectionBitmap::chunk_size() const { return _chunk_size; }
+
+ChunkOffset SelectionBitmap::operator[](size_t index) const {
+  DebugAssert(index < _size, "invalid index");
+
+  // the last word whose rank is not greater than the index contains the row
+  const auto word_index =
+      static_cast<size_t>(std::distance(_ranks.cbegin(), std::upper_bound(_ranks.cbegin(), _ranks.cend(), index))) - 1;
+  auto word = _words[word_index];
+  for (auto remaining = index - _ranks[word_index]; remaining > 0; --remaining) {
+    word &= word - 1;
+  }
+  return static_cast<ChunkOffset>(word_index * BITS_PER_WORD + __builtin_ctzll(word));
+}
+
+ChunkOffsetList SelectionBitmap::to_chunk_offsets() const {
+  auto chunk_offsets = ChunkOffsetList(_words.get_allocator());
+  chunk_offsets.reserve(_size);
+  for_each([&](const ChunkOffset chunk_offset) { chunk_offsets.push_back(chunk_offset); });
+  return chunk_offsets;
+}
+
+const pmr_vector<uint64_t>& SelectionBitmap::words() const { return _words; }
+
+size_t SelectionBitmap::estimate_memory_usage() const {
+  return sizeof(*this) + vector_heap_size(_words) + vector_heap_size(_ranks);
+}
+
+}  // namespace opossum
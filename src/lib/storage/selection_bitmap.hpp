@@ -0,0 +1,67 @@
+#pragma once
+
+#include <cstdint>
+#include <utility>
+
+#include "types.hpp"
+
+namespace opossum {
+
+// A SelectionBitmap marks the selected rows of a chunk with one bit per row. It is an alternative to a ChunkOffsetList
+// for intermediate results that keep many rows of a chunk, e.g., the result of a scan with a predicate that most rows
+// satisfy: the scan sets the bits without branching, and the bitmap needs far less memory than the offsets would.
+// The number of selected rows before each word is stored as well, so that the n-th selected row can be found without
+// counting the bits of all words before it.
+class SelectionBitmap {
+ public:
+  static constexpr ChunkOffset BITS_PER_WORD = 64;
+
+  // returns the number of words needed for a chunk with the given number of rows
+  static size_t word_count(const ChunkOffset chunk_size) { return (chunk_size + BITS_PER_WORD - 1) / BITS_PER_WORD; }
+
+  // returns whether a bitmap for a chunk of chunk_size rows needs less memory than a ChunkOffsetList with
+  // selected_count entries
+  static bool is_smaller_than_chunk_offsets(size_t selected_count, ChunkOffset chunk_size);
+
+  // takes the words of the bitmap, in which bit i % 64 of word i / 64 is set if row i of the chunk is selected
+  SelectionBitmap(pmr_vector<uint64_t>&& words, ChunkOffset chunk_size);
+
+  // returns the number of selected rows
+  size_t size() const;
+
+  // returns the number of rows of the chunk
+  ChunkOffset chunk_size() const;
+
+  bool is_selected(const ChunkOffset chunk_offset) const {
+    return (_words[chunk_offset / BITS_PER_WORD] >> (chunk_offset % BITS_PER_WORD)) & 1u;
+  }
+
+  // returns the chunk offset of the n-th selected row
+  ChunkOffset operator[](size_t index) const;
+
+  // calls function(chunk_offset) for every selected row in ascending order
+  template <typename Function>
+  void for_each(const Function& function) const {
+    for (size_t word_index = 0; word_index < _words.size(); ++word_index) {
+      for (auto word = _words[word_index]; word != 0; word &= word - 1) {
+        function(static_cast<ChunkOffset>(word_index * BITS_PER_WORD + __builtin_ctzll(word)));
+      }
+    }
+  }
+
+  // returns the offsets of the selected rows, allocated with the allocator of the bitmap
+  ChunkOffsetList to_chunk_offsets() const;
+
+  const pmr_vector<uint64_t>& words() const;
+
+  size_t estimate_memory_usage() const;
+
+ protected:
+  pmr_vector<uint64_t> _words;
+  // the number of selected rows in all words before each word
+  pmr_vector<uint32_t> _ranks;
+  ChunkOffset _chunk_size;
+  size_t _size = 0;
+};
+
+}  // namespace opossum
@@ -1,42 +1,156 @@
 #include "storage_manager.hpp"
 
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
 #include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <fstream>
 #include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <sstream>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include "operators/export_binary.hpp"
+#include "operators/import_binary.hpp"
 #include "utils/assert.hpp"
+#include "utils/metrics.hpp"
 
 namespace opossum {
 
+namespace {
+
+constexpr auto CATALOG_FILE_NAME = "catalog";
+
+// forces the contents of a file or of a directory to disk
+void sync_path(const std::string& path) {
+  const auto file_descriptor = open(path.c_str(), O_RDONLY);
+  Assert(file_descriptor >= 0, "StorageManager: Could not open " + path);
+  const auto sync_result = fsync(file_descriptor);
+  close(file_descriptor);
+  Assert(sync_result == 0, "StorageManager: Could not sync " + path);
+}
+
+// returns the names of the table files in the catalog of the directory, which are relative to the directory
+std::vector<std::string> catalog_file_names(const std::string& directory) {
+  auto file_names = std::vector<std::string>{};
+  std::ifstream catalog_file(directory + "/" + CATALOG_FILE_NAME);
+  for (std::string line; std::getline(catalog_file, line);) {
+    file_names.push_back(line.substr(0, line.find(' ')));
+  }
+  return file_names;
+}
+
+// adds the metrics of the loaded tables, which are computed when the metrics are exported
+void add_metrics_collectors(const StorageManager& storage_manager) {
+  const auto collect_per_table = [&storage_manager](const auto& function) {
+    return [&storage_manager, function]() {
+      auto samples = std::vector<MetricSample>{};
+      for (const auto& [name, table] : storage_manager.loaded_tables()) {
+        samples.push_back(MetricSample{{{"table", name}}, static_cast<double>(function(*table))});
+      }
+      return samples;
+    };
+  };
+
+  auto& registry = MetricsRegistry::get();
+  registry.add_collector("opossum_table_memory_bytes", "Estimated memory usage of the tables in the StorageManager",
+                         MetricType::Gauge,
+                         collect_per_table([](const Table& table) { return table.estimate_memory_usage(); }));
+  registry.add_collector("opossum_table_rows", "Number of rows of the tables in the StorageManager", MetricType::Gauge,
+                         collect_per_table([](const Table& table) { return table.row_count(); }));
+  registry.add_collector("opossum_table_chunks", "Number of chunks of the tables in the StorageManager",
+                         MetricType::Gauge,
+                         collect_per_table([](const Table& table) { return table.chunk_count(); }));
+  registry.add_collector("opossum_compression_backlog_chunks",
+                         "Number of full chunks of the tables in the StorageManager that are not compressed yet",
+                         MetricType::Gauge,
+                         collect_per_table([](const Table& table) { return table.uncompressed_full_chunk_count(); }));
+}
+
+}  // namespace
+
+StorageManager::StorageManager() { add_metrics_collectors(*this); }
+
 StorageManager& StorageManager::get() {
   static StorageManager instance;
   return instance;
 }
 
 void StorageManager::add_table(const std::string& name, std::shared_ptr<Table> table) {
-  Assert(!has_table(name), "this table name is already used: " + name);
+  std::unique_lock lock(_catalog_mutex);
+  Assert(!_has_table_without_locking(name), "this table name is already used: " + name);
   _tables[name] = table;
+  ++_catalog_version;
 }
 
 void StorageManager::drop_table(const std::string& name) {
-  Assert(has_table(name), "this table name does not exist: " + name);
+  std::unique_lock lock(_catalog_mutex);
+  Assert(_has_table_without_locking(name), "this table name does not exist: " + name);
   _tables.erase(name);
+  _checkpointed_tables.erase(name);
+  ++_catalog_version;
 }
 
-std::shared_ptr<Table> StorageManager::get_table(const std::string& name) const { return _tables.at(name); }
+std::shared_ptr<Table> StorageManager::get_table(const std::string& name) const {
+  auto load = std::shared_ptr<TableLoad>{};
+  auto file_name = std::string{};
+  {
+    std::shared_lock lock(_catalog_mutex);
+    const auto checkpointed_table = _checkpointed_tables.find(name);
+    if (checkpointed_table == _checkpointed_tables.cend()) return _tables.at(name);
+    load = checkpointed_table->second.load;
+    file_name = checkpointed_table->second.file_name;
+  }
 
-bool StorageManager::has_table(const std::string& name) const { return _tables.find(name) != _tables.cend(); }
+  // Loading a large table takes long, so the catalog stays available meanwhile. Concurrent requests wait for the
+  // first one, and a failed load is tried again by the next request.
+  std::call_once(load->once_flag, [&]() { load->table = ImportBinary::read_table(file_name); });
+
+  std::unique_lock lock(_catalog_mutex);
+  // the table is only published if it has not been dropped or replaced during the load
+  const auto checkpointed_table = _checkpointed_tables.find(name);
+  if (checkpointed_table != _checkpointed_tables.cend() && checkpointed_table->second.load == load) {
+    _tables[name] = load->table;
+    _checkpointed_tables.erase(checkpointed_table);
+  }
+  return load->table;
+}
+
+uint64_t StorageManager::catalog_version() const { return _catalog_version; }
+
+bool StorageManager::has_table(const std::string& name) const {
+  std::shared_lock lock(_catalog_mutex);
+  return _has_table_without_locking(name);
+}
+
+bool StorageManager::_has_table_without_locking(const std::string& name) const {
+  return _tables.find(name) != _tables.cend() || _checkpointed_tables.find(name) != _checkpointed_tables.cend();
+}
 
 std::vector<std::string> StorageManager::table_names() const {
+  std::shared_lock lock(_catalog_mutex);
   auto table_names = std::vector<std::string>(_tables.size());
   std::transform(_tables.cbegin(), _tables.cend(), table_names.begin(),
                  [](auto value_pair) { return value_pair.first; });
+  for (const auto& checkpointed_table_pair : _checkpointed_tables) {
+    table_names.push_back(checkpointed_table_pair.first);
+  }
   return table_names;
 }
 
+std::vector<std::pair<std::string, std::shared_ptr<const Table>>> StorageManager::loaded_tables() const {
+  std::shared_lock lock(_catalog_mutex);
+  return {_tables.cbegin(), _tables.cend()};
+}
+
 void StorageManager::print(std::ostream& out) const {
+  std::shared_lock lock(_catalog_mutex);
   for (const auto& table_pair : _tables) {
     const auto table_name = table_pair.first;
     const auto column_count = table_pair.second->column_count();
@@ -44,8 +158,120 @@ void StorageManager::print(std::ostream& out) const {
     const auto chunk_count = table_pair.second->chunk_count();
     out << table_name << ' ' << column_count << ' ' << row_count << ' ' << chunk_count << std::endl;
   }
+
+  // tables that have not been loaded yet are printed from the information in the catalog
+  for (const auto& checkpointed_table_pair : _checkpointed_tables) {
+    const auto& checkpointed_table = checkpointed_table_pair.second;
+    out << checkpointed_table_pair.first << ' ' << checkpointed_table.column_count << ' '
+        << checkpointed_table.row_count << ' ' << checkpointed_table.chunk_count << std::endl;
+  }
 }
 
-void StorageManager::reset() { StorageManager::get()._tables.clear(); }
+size_t StorageManager::estimate_memory_usage() const {
+  std::shared_lock lock(_catalog_mutex);
+  auto bytes = size_t{0};
+  for (const auto& table_pair : _tables) {
+    bytes += table_pair.second->estimate_memory_usage();
+  }
+  return bytes;
+}
+
+void StorageManager::print_memory_usage(std::ostream& out) const {
+  std::shared_lock lock(_catalog_mutex);
+  for (const auto& table_pair : _tables) {
+    const auto& table = table_pair.second;
+    out << table_pair.first << ' ' << table->estimate_memory_usage() << std::endl;
+    for (ColumnID column_id{0}; column_id < table->column_count(); ++column_id) {
+      out << "  " << table->column_name(column_id) << ' ' << table->column_type(column_id) << ' '
+          << table->estimate_column_memory_usage(column_id) << std::endl;
+    }
+  }
+}
+
+void StorageManager::checkpoint(const std::string& directory) const {
+  const auto mkdir_result = mkdir(directory.c_str(), 0755);
+  Assert(mkdir_result == 0 || errno == EEXIST, "StorageManager: Could not create directory " + directory);
+
+  // tables that have been restored from this directory are loaded before any file is written
+  auto tables = std::vector<std::pair<std::string, std::shared_ptr<const Table>>>{};
+  for (const auto& table_name : table_names()) {
+    tables.emplace_back(table_name, get_table(table_name));
+  }
+  const auto previous_file_names = catalog_file_names(directory);
+
+  // The files are written to a new data directory, so that the files of the previous checkpoint remain intact until
+  // the new catalog has replaced the previous one.
+  auto data_directory_name = std::string{};
+  for (auto data_directory_id = size_t{0};; ++data_directory_id) {
+    data_directory_name = "data_" + std::to_string(data_directory_id);
+    if (mkdir((directory + "/" + data_directory_name).c_str(), 0755) == 0) break;
+    Assert(errno == EEXIST, "StorageManager: Could not create directory " + directory + "/" + data_directory_name);
+  }
+
+  // table names may contain characters that are not allowed in file names, so the files are numbered instead
+  auto catalog = std::ostringstream{};
+  auto table_id = size_t{0};
+  for (const auto& [table_name, table] : tables) {
+    const auto file_name = data_directory_name + "/table_" + std::to_string(table_id++) + ".bin";
+    ExportBinary::write_table(*table, directory + "/" + file_name);
+    sync_path(directory + "/" + file_name);
+    catalog << file_name << ' ' << table->column_count() << ' ' << table->row_count() << ' ' << table->chunk_count()
+            << ' ' << table_name << '\n';
+  }
+  sync_path(directory + "/" + data_directory_name);
+
+  const auto catalog_file_name = directory + "/" + CATALOG_FILE_NAME;
+  const auto temporary_catalog_file_name = catalog_file_name + ".tmp";
+  {
+    std::ofstream catalog_file(temporary_catalog_file_name, std::ios::trunc);
+    catalog_file << catalog.str();
+    catalog_file.close();
+    Assert(catalog_file.good(), "StorageManager: Could not write catalog " + temporary_catalog_file_name);
+  }
+  sync_path(temporary_catalog_file_name);
+  Assert(std::rename(temporary_catalog_file_name.c_str(), catalog_file_name.c_str()) == 0,
+         "StorageManager: Could not replace catalog " + catalog_file_name);
+  sync_path(directory);
+
+  // the files of the previous checkpoint are no longer referenced
+  for (const auto& file_name : previous_file_names) {
+    std::remove((directory + "/" + file_name).c_str());
+    const auto separator = file_name.find('/');
+    if (separator != std::string::npos) rmdir((directory + "/" + file_name.substr(0, separator)).c_str());
+  }
+}
+
+void StorageManager::restore(const std::string& directory) {
+  const auto catalog_file_name = directory + "/" + CATALOG_FILE_NAME;
+  std::ifstream catalog_file(catalog_file_name);
+  Assert(catalog_file.is_open(), "StorageManager: Could not find catalog " + catalog_file_name);
+
+  std::unique_lock lock(_catalog_mutex);
+  auto file_name = std::string{};
+  auto column_count = uint16_t{0};
+  auto row_count = uint64_t{0};
+  auto chunk_count = ChunkID::base_type{0};
+  while (catalog_file >> file_name >> column_count >> row_count >> chunk_count) {
+    // the table name is the remainder of the line and might contain spaces
+    catalog_file.ignore(1);
+    auto table_name = std::string{};
+    std::getline(catalog_file, table_name);
+
+    Assert(!_has_table_without_locking(table_name), "this table name is already used: " + table_name);
+    _checkpointed_tables[table_name] =
+        CheckpointedTable{directory + "/" + file_name, column_count, row_count, ChunkID{chunk_count},
+                          std::make_shared<TableLoad>()};
+    ++_catalog_version;
+  }
+  Assert(catalog_file.eof(), "StorageManager: Could not parse catalog " + catalog_file_name);
+}
+
+void StorageManager::reset() {
+  auto& storage_manager = StorageManager::get();
+  std::unique_lock lock(storage_manager._catalog_mutex);
+  storage_manager._tables.clear();
+  storage_manager._checkpointed_tables.clear();
+  ++storage_manager._catalog_version;
+}
 
 }  // namespace opossum
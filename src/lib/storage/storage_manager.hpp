@@ -1,9 +1,13 @@
 #pragma once
 
+#include <atomic>
 #include <iostream>
 #include <memory>
+#include <mutex>
+#include <shared_mutex>
 #include <string>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "storage/table.hpp"
@@ -13,6 +17,10 @@ namespace opossum {
 
 // The StorageManager is a singleton that maintains all tables
 // by mapping table names to table instances.
+//
+// All tables can be written to a checkpoint directory. After a restart, the checkpoint can be restored: the catalog
+// (names, column/row/chunk counts) is available immediately, while the data of a table is only loaded from its file
+// when the table is first requested via get_table.
 class StorageManager : private Noncopyable {
  public:
   static StorageManager& get();
@@ -23,28 +31,79 @@ class StorageManager : private Noncopyable {
   // removes the table from the storage manger
   void drop_table(const std::string& name);
 
-  // returns the table instance with the given name
+  // returns the table instance with the given name, loading it from its checkpoint file if necessary
   std::shared_ptr<Table> get_table(const std::string& name) const;
 
   // returns whether the storage manager holds a table with the given name
   bool has_table(const std::string& name) const;
 
+  // returns a number that changes whenever tables are added, dropped or restored, so that cached lookups (e.g., those
+  // of a PreparedPlan) can tell whether they are still valid
+  uint64_t catalog_version() const;
+
   // returns a list of all table names
   std::vector<std::string> table_names() const;
 
+  // returns the tables that are in memory, i.e., all tables except those restored from a checkpoint and not loaded yet
+  std::vector<std::pair<std::string, std::shared_ptr<const Table>>> loaded_tables() const;
+
   // prints information about all tables in the storage manager (name, #columns, #rows, #chunks)
   void print(std::ostream& out = std::cout) const;
 
+  // returns the estimated number of bytes used by all tables in the storage manager
+  // tables that have been restored from a checkpoint but not been loaded yet do not use any memory
+  size_t estimate_memory_usage() const;
+
+  // prints the estimated memory usage of all loaded tables (name, #bytes), each followed by a breakdown of its columns
+  // (indented name, type, #bytes)
+  void print_memory_usage(std::ostream& out = std::cout) const;
+
+  // Writes all tables in the binary format of ExportBinary to the given directory, which is created if necessary,
+  // together with a catalog file. All tables are loaded first. The table files are written to a new subdirectory and
+  // synced before the catalog is replaced atomically, so that a crash leaves either the previous or the new checkpoint.
+  // The files of the previous checkpoint are removed afterwards.
+  void checkpoint(const std::string& directory) const;
+
+  // Registers all tables of a checkpoint written by checkpoint(). Their data is loaded on first access.
+  void restore(const std::string& directory);
+
   // deletes the entire StorageManager and creates a new one, used especially in tests
   static void reset();
 
   StorageManager(StorageManager&&) = delete;
 
  protected:
-  StorageManager() {}
+  // registers the metrics of the tables with the MetricsRegistry
+  StorageManager();
   StorageManager& operator=(StorageManager&&) = default;
 
+  // the loading of a checkpointed table, which the threads that request the table concurrently share, so that the
+  // table is loaded only once and without holding the catalog lock
+  struct TableLoad {
+    std::once_flag once_flag;
+    std::shared_ptr<Table> table;
+  };
+
+  // a table that has been restored from a checkpoint but whose data has not been loaded yet
+  struct CheckpointedTable {
+    std::string file_name;
+    uint16_t column_count;
+    uint64_t row_count;
+    ChunkID chunk_count;
+    std::shared_ptr<TableLoad> load;
+  };
+
   // mapping from table names to table object pointers
-  std::unordered_map<std::string, std::shared_ptr<Table>> _tables;
+  // mutable, because get_table moves tables from _checkpointed_tables to _tables when they are loaded
+  mutable std::unordered_map<std::string, std::shared_ptr<Table>> _tables;
+  mutable std::unordered_map<std::string, CheckpointedTable> _checkpointed_tables;
+
+  bool _has_table_without_locking(const std::string& name) const;
+
+  // protects _tables and _checkpointed_tables, readers share it
+  // checkpointed tables are loaded without holding it and moved to _tables afterwards
+  mutable std::shared_mutex _catalog_mutex;
+
+  std::atomic<uint64_t> _catalog_version{0};
 };
 }  // namespace opossum
@@ -6,15 +6,21 @@
 #include <memory>
 #include <numeric>
 #include <string>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
 #include "value_segment.hpp"
 
+#include "buffer_manager.hpp"
 #include "dictionary_segment.hpp"
 #include "resolve_type.hpp"
+#include "statistics/table_statistics.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
+#include "utils/size_estimation_utils.hpp"
+#include "utils/tracing.hpp"
+#include "write_ahead_log.hpp"
 
 namespace opossum {
 
@@ -44,20 +50,43 @@ void Table::add_column(const std::string& name, const std::string& type) {
          "column with name " + name + " already exist");
   _column_names.push_back(name);
   _column_types.push_back(type);
+  _column_dictionaries.emplace_back();
+  _column_dictionary_versions.push_back(0);
   _add_segment_to_chunk(_chunks[0], type);
 }
 
 void Table::append(std::vector<AllTypeVariant> values) {
   DebugAssert(_chunks.back()->size() <= _chunk_size, "chunk contains more values than allowed ");
-  std::lock_guard lock(_chunk_mutex);
-  if (_chunks.back()->size() == _chunk_size) {
-    std::shared_ptr<Chunk> new_chunk = std::make_shared<Chunk>();
-    _init_chunk(new_chunk);
-    new_chunk->append(values);
-    _emplace_chunk_without_locking(std::move(*new_chunk));
-  } else {
-    _chunks.back()->append(values);
+  const auto write_ahead_log = _write_ahead_log;
+  auto log_group_id = uint64_t{0};
+  {
+    std::lock_guard lock(_chunk_mutex);
+    // The row is logged while the table is locked, so that the log contains the rows in the order of the table. It is
+    // logged before it is inserted: log_append rejects rows whose values do not fit the columns and all rows once the
+    // log has failed, so that the table never contains a row that is missing from its log.
+    if (write_ahead_log) {
+      log_group_id = write_ahead_log->log_append(_write_ahead_log_table_name, *this, _row_count, values);
+    }
+
+    if (_chunks.back()->size() == _chunk_size) {
+      std::shared_ptr<Chunk> new_chunk = std::make_shared<Chunk>();
+      _init_chunk(new_chunk);
+      new_chunk->append(values);
+      _emplace_chunk_without_locking(std::move(new_chunk));
+    } else {
+      _chunks.back()->append(values);
+    }
+    ++_row_count;
+    ++_version;
   }
+
+  // the lock is not held, because a synchronous commit blocks until the row is durable
+  if (write_ahead_log) write_ahead_log->commit(log_group_id);
+}
+
+void Table::set_write_ahead_log(std::shared_ptr<WriteAheadLog> write_ahead_log, const std::string& table_name) {
+  _write_ahead_log = std::move(write_ahead_log);
+  _write_ahead_log_table_name = table_name;
 }
 
 uint16_t Table::column_count() const { return _column_names.size(); }
@@ -66,15 +95,10 @@ void Table::create_new_chunk() {
   // Implementation goes here
 }
 
-uint64_t Table::row_count() const {
-  uint64_t row_count = 0u;
-  for (const auto& chunk : _chunks) {
-    row_count += chunk->size();
-  }
-  return row_count;
-}
+uint64_t Table::row_count() const { return _row_count; }
 
 ChunkID Table::chunk_count() const {
+  std::shared_lock lock(_chunk_mutex);
   DebugAssert(_chunks.size() > 0, "there must always be a chunk");
   return ChunkID(_chunks.size());
 }
@@ -112,37 +136,183 @@ const Chunk& Table::get_chunk(ChunkID chunk_id) const {
   // return *(_chunks[chunk_id]);
 }
 
-void Table::compress_chunk(ChunkID chunk_id) {
+void Table::compress_chunk(ChunkID chunk_id, DictionaryScope dictionary_scope) {
   DebugAssert(chunk_id < _chunks.size(), "invalid chunk id");
+  TRACE_SPAN("compression", "compress chunk", "chunk " + std::to_string(chunk_id));
   const auto chunk = _chunks[chunk_id];
   auto new_chunk = std::make_shared<Chunk>();
   for (ColumnID column_id = ColumnID{0}; column_id < chunk->column_count(); column_id++) {
-    auto dictionary_segment =
-        make_shared_by_data_type<BaseSegment, DictionarySegment>(column_type(column_id), chunk->get_segment(column_id));
-    new_chunk->add_segment(dictionary_segment);
+    if (dictionary_scope == DictionaryScope::Chunk) {
+      auto dictionary_segment = make_shared_by_data_type<BaseSegment, DictionarySegment>(
+          column_type(column_id), chunk->get_segment(column_id));
+      new_chunk->add_segment(dictionary_segment);
+      continue;
+    }
+
+    // the dictionary of the column is locked until the segment is built, so that concurrently compressed chunks
+    // cannot create diverging versions of it
+    std::lock_guard dictionary_lock(_dictionary_mutex);
+    resolve_data_type(column_type(column_id), [&](auto type) {
+      using Type = typename decltype(type)::type;
+      using Dictionary = std::shared_ptr<const ValueVector<Type>>;
+
+      auto& column_dictionary = _column_dictionaries[column_id];
+      auto dictionary = column_dictionary.has_value() ? std::any_cast<Dictionary>(column_dictionary) : nullptr;
+      const auto dictionary_segment =
+          std::make_shared<DictionarySegment<Type>>(chunk->get_segment(column_id), dictionary);
+      new_chunk->add_segment(dictionary_segment);
+      if (dictionary_segment->dictionary() == dictionary) return;
+
+      // each version contains the values of the previous ones, so that the other segments can be re-encoded with it
+      column_dictionary = dictionary_segment->dictionary();
+      if (++_column_dictionary_versions[column_id] > MAX_COLUMN_DICTIONARY_VERSIONS) {
+        _unify_dictionary_without_locking(column_id);
+      }
+    });
   }
+  // the dictionaries are built by the calling thread, which should run on the chunk's node to keep the placement
+  new_chunk->set_node_id(chunk->node_id());
+  _replace_chunk(chunk_id, std::move(new_chunk));
+  ++_version;
+}
+
+void Table::unify_dictionary(ColumnID column_id) {
+  std::lock_guard dictionary_lock(_dictionary_mutex);
+  _unify_dictionary_without_locking(column_id);
+}
+
+void Table::_unify_dictionary_without_locking(ColumnID column_id) {
+  DebugAssert(column_id < column_count(), "invalid column id");
+  TRACE_SPAN("compression", "unify dictionary", "column " + column_name(column_id));
+
+  resolve_data_type(column_type(column_id), [&](auto type) {
+    using Type = typename decltype(type)::type;
+    using Dictionary = std::shared_ptr<const ValueVector<Type>>;
+
+    auto& column_dictionary = _column_dictionaries[column_id];
+    auto dictionary = column_dictionary.has_value() ? std::any_cast<Dictionary>(column_dictionary) : nullptr;
+
+    // merge the dictionaries of all segments into the current one
+    auto segments = std::vector<std::shared_ptr<const DictionarySegment<Type>>>(chunk_count());
+    for (ChunkID chunk_id{0}; chunk_id < chunk_count(); ++chunk_id) {
+      const auto& chunk = get_chunk(chunk_id);
+      if (chunk.column_count() <= column_id) continue;
+      segments[chunk_id] = std::dynamic_pointer_cast<const DictionarySegment<Type>>(chunk.get_segment(column_id));
+      if (!segments[chunk_id] || segments[chunk_id]->dictionary() == dictionary) continue;
+
+      const auto& segment_dictionary = segments[chunk_id]->dictionary();
+      if (!dictionary) {
+        dictionary = segment_dictionary;
+      } else if (!std::includes(dictionary->cbegin(), dictionary->cend(), segment_dictionary->cbegin(),
+                                segment_dictionary->cend())) {
+        dictionary = DictionarySegment<Type>::merge_dictionaries(*dictionary, *segment_dictionary);
+      }
+    }
+    if (!dictionary) return;
+
+    for (ChunkID chunk_id{0}; chunk_id < segments.size(); ++chunk_id) {
+      if (!segments[chunk_id] || segments[chunk_id]->dictionary() == dictionary) continue;
+
+      const auto& chunk = get_chunk(chunk_id);
+      auto new_chunk = std::make_shared<Chunk>();
+      for (ColumnID chunk_column_id{0}; chunk_column_id < chunk.column_count(); ++chunk_column_id) {
+        new_chunk->add_segment(chunk_column_id == column_id
+                                   ? std::make_shared<DictionarySegment<Type>>(*segments[chunk_id], dictionary)
+                                   : chunk.get_segment(chunk_column_id));
+      }
+      new_chunk->set_node_id(chunk.node_id());
+      _replace_chunk(chunk_id, std::move(new_chunk));
+    }
+    column_dictionary = dictionary;
+    _column_dictionary_versions[column_id] = 1;
+  });
+  ++_version;
+}
+
+void Table::_replace_chunk(ChunkID chunk_id, std::shared_ptr<Chunk> new_chunk) {
+  BufferManager::get().register_chunk(new_chunk, _column_types);
+
   std::lock_guard lock(_chunk_mutex);
   _chunks[chunk_id] = std::move(new_chunk);
 }
 
-void Table::_emplace_chunk_without_locking(Chunk&& chunk) {
-  DebugAssert(chunk.size() <= _chunk_size, "chunk is too big");
+size_t Table::estimate_memory_usage() const {
+  auto bytes = sizeof(*this) + vector_heap_size(_column_names) + vector_heap_size(_column_types);
+
+  // dictionaries that are shared by the segments of a column are counted once
+  auto counted_shared_memory = std::unordered_set<const void*>{};
+  std::shared_lock lock(_chunk_mutex);
+  bytes += _chunks.capacity() * sizeof(std::shared_ptr<Chunk>);
+  for (const auto& chunk : _chunks) {
+    bytes += chunk->estimate_memory_usage(counted_shared_memory);
+  }
+  return bytes;
+}
+
+size_t Table::estimate_column_memory_usage(ColumnID column_id) const {
+  DebugAssert(column_id < column_count(), "invalid column id");
+  auto bytes = size_t{0};
+  auto counted_shared_memory = std::unordered_set<const void*>{};
+
+  std::shared_lock lock(_chunk_mutex);
+  for (const auto& chunk : _chunks) {
+    // the first chunk of a table without rows might be missing its segments
+    if (chunk->column_count() <= column_id) continue;
+    bytes += chunk->get_segment(column_id)->estimate_memory_usage_deduplicated(counted_shared_memory);
+  }
+  return bytes;
+}
+
+ChunkID Table::uncompressed_full_chunk_count() const {
+  if (column_count() == 0) return ChunkID{0};
+  auto chunk_count = ChunkID{0};
+  resolve_data_type(column_type(ColumnID{0}), [&](auto type) {
+    using Type = typename decltype(type)::type;
+    std::shared_lock lock(_chunk_mutex);
+    for (const auto& chunk : _chunks) {
+      // chunks of the BufferManager are compressed, this also avoids loading evicted chunks
+      if (!chunk->is_resident() || chunk->size() < _chunk_size) continue;
+      if (std::dynamic_pointer_cast<const ValueSegment<Type>>(chunk->get_segment(ColumnID{0}))) ++chunk_count;
+    }
+  });
+  return chunk_count;
+}
+
+void Table::_emplace_chunk_without_locking(std::shared_ptr<Chunk> chunk) {
+  DebugAssert(chunk->size() <= _chunk_size, "chunk is too big");
   // TODO(anyone) should we check data types as well?
-  DebugAssert(chunk.column_count() == column_count(), "chunk column count does not match");
+  DebugAssert(chunk->column_count() == column_count(), "chunk column count does not match");
 
   if (row_count() == 0) {
-    _chunks[0] = std::make_shared<Chunk>(std::move(chunk));
+    _chunks[0] = std::move(chunk);
     return;
   }
 
-  // TODO(anyone) do we need this assert?
-  DebugAssert(_chunks.back()->size() == _chunk_size, "last chunk is not full");
-  _chunks.emplace_back(std::make_shared<Chunk>(std::move(chunk)));
+  // the chunks of operator results are not necessarily full, e.g., a scan emits one chunk per input chunk
+  _chunks.emplace_back(std::move(chunk));
 }
 
 void Table::emplace_chunk(Chunk&& chunk) {
+  auto new_chunk = std::make_shared<Chunk>(std::move(chunk));
+  // the chunk is registered before other threads can see it, so that they never access it while it is registered
+  BufferManager::get().register_chunk(new_chunk, _column_types);
+
   std::lock_guard lock(_chunk_mutex);
-  _emplace_chunk_without_locking(std::move(chunk));
+  const auto chunk_row_count = new_chunk->size();
+  _emplace_chunk_without_locking(std::move(new_chunk));
+  _row_count += chunk_row_count;
+  ++_version;
+}
+
+uint64_t Table::version() const { return _version; }
+
+std::shared_ptr<const TableStatistics> Table::table_statistics() const {
+  std::lock_guard lock(_table_statistics_mutex);
+  if (!_table_statistics || _table_statistics->table_version() != _version) {
+    _table_statistics =
+        std::make_shared<TableStatistics>(*this, BaseColumnStatistics::DEFAULT_BUCKET_COUNT, _table_statistics);
+  }
+  return _table_statistics;
 }
 
 }  // namespace opossum
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <any>
+#include <atomic>
 #include <limits>
 #include <map>
 #include <memory>
@@ -18,6 +20,7 @@
 namespace opossum {
 
 class TableStatistics;
+class WriteAheadLog;
 
 // A table is partitioned horizontally into a number of chunks
 class Table : private Noncopyable {
@@ -48,6 +51,7 @@ class Table : private Noncopyable {
   const Chunk& get_chunk(ChunkID chunk_id) const;
 
   // Adds a chunk to the table. If the first chunk is empty, it is replaced.
+  // Chunks that are already dictionary-encoded are handed over to the BufferManager, just like in compress_chunk.
   void emplace_chunk(Chunk&& chunk);
 
   // Returns a list of all column names.
@@ -79,15 +83,54 @@ class Table : private Noncopyable {
 
   // inserts a row at the end of the table
   // note this is slow and not thread-safe and should be used for testing purposes only
+  // if the table has a write-ahead log, the row is logged before it is inserted, and it is not inserted if the log
+  // rejects it
   void append(std::vector<AllTypeVariant> values);
 
+  // enables logging of all rows inserted via append to the given log (or disables it if nullptr is passed)
+  // the table name is stored in the log to identify the table when the log is replayed
+  void set_write_ahead_log(std::shared_ptr<WriteAheadLog> write_ahead_log, const std::string& table_name);
+
   // creates a new chunk and appends it
   void create_new_chunk();
 
   // compresses a ValueSegment into a DictionarySegment
-  void compress_chunk(ChunkID chunk_id);
+  // if the BufferManager has a memory budget, the compressed chunk is handed over to it and may be evicted to disk
+  // with DictionaryScope::Column, the segments share the sorted dictionary of their column, which is extended by a
+  // new version whenever a chunk contains values that are not part of it yet (see DictionarySegment). Once the column
+  // has MAX_COLUMN_DICTIONARY_VERSIONS versions, it is unified (see unify_dictionary), so that the older versions are
+  // released and the ValueIDs of all compressed chunks can be compared again.
+  void compress_chunk(ChunkID chunk_id, DictionaryScope dictionary_scope = DictionaryScope::Chunk);
+
+  static constexpr uint32_t MAX_COLUMN_DICTIONARY_VERSIONS = 8;
+
+  // re-encodes all dictionary segments of the column with one dictionary that contains the values of all of them, so
+  // that the ValueIDs of all compressed chunks can be compared (e.g., by joins and aggregates). Chunks that are
+  // compressed with DictionaryScope::Column afterwards continue to use this dictionary.
+  // segments that the BufferManager loads again after evicting them get a private copy of their dictionary
+  void unify_dictionary(ColumnID column_id);
+
+  // returns the estimated number of bytes used by the table, including all chunks and the column definitions
+  size_t estimate_memory_usage() const;
+
+  // returns the estimated number of bytes used by the segments of the given column across all chunks
+  size_t estimate_column_memory_usage(ColumnID column_id) const;
+
+  // returns the number of full chunks that still consist of ValueSegments, i.e., that are waiting to be compressed
+  ChunkID uncompressed_full_chunk_count() const;
+
+  // returns a counter that is incremented whenever rows are appended, chunks are added, a chunk is compressed or a
+  // dictionary is unified, so that results computed from an earlier state of the table can be recognized (see
+  // ResultCache)
+  uint64_t version() const;
+
+  // returns statistics about the values of the table, which are computed when they are first requested after the
+  // table was changed (see TableStatistics)
+  std::shared_ptr<const TableStatistics> table_statistics() const;
 
  protected:
+  friend class TableStatistics;
+
   // list of all chunks
   std::vector<std::shared_ptr<Chunk>> _chunks;
 
@@ -103,8 +146,31 @@ class Table : private Noncopyable {
   // mutex to lock a chunk
   mutable std::shared_mutex _chunk_mutex;
 
+  // the number of rows, which is maintained by append and emplace_chunk so that it does not have to be summed up
+  std::atomic<uint64_t> _row_count{0};
+
+  std::atomic<uint64_t> _version{0};
+
+  // the statistics of the latest version for which they were requested
+  mutable std::shared_ptr<const TableStatistics> _table_statistics;
+  mutable std::mutex _table_statistics_mutex;
+
+  // the current shared dictionary of each column (std::shared_ptr<const ValueVector<T>>), empty until the first chunk
+  // is compressed with DictionaryScope::Column; protected by _dictionary_mutex
+  std::vector<std::any> _column_dictionaries;
+  // the number of versions of each column's dictionary that segments may use since it was last unified
+  std::vector<uint32_t> _column_dictionary_versions;
+  std::mutex _dictionary_mutex;
+
+  // optional log for appended rows and the name under which the table is logged
+  std::shared_ptr<WriteAheadLog> _write_ahead_log;
+  std::string _write_ahead_log_table_name;
+
   // emplaces a chunk without locking the chunk vector
-  void _emplace_chunk_without_locking(Chunk&& chunk);
+  void _emplace_chunk_without_locking(std::shared_ptr<Chunk> chunk);
+
+  // unify_dictionary for callers that hold _dictionary_mutex
+  void _unify_dictionary_without_locking(ColumnID column_id);
 
   // adds a new empty chunk at the end of the chunk list
   void _init_chunk(std::shared_ptr<Chunk>&);
@@ -112,6 +178,9 @@ class Table : private Noncopyable {
   // adds an empty segment of given type to given chunk
   void _add_segment_to_chunk(std::shared_ptr<Chunk> chunk, const std::string& type);
 
+  // replaces a chunk with its compressed version and hands it over to the BufferManager
+  void _replace_chunk(ChunkID chunk_id, std::shared_ptr<Chunk> new_chunk);
+
   template <typename T>
   static Chunk& _get_chunk_impl(T& self, ChunkID chunk_id);
 };
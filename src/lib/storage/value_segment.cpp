@@ -10,13 +10,20 @@
 #include "type_cast.hpp"
 #include "utils/assert.hpp"
 #include "utils/performance_warning.hpp"
+#include "utils/size_estimation_utils.hpp"
 
 namespace opossum {
 
+template <typename T>
+ValueSegment<T>::ValueSegment(const PolymorphicAllocator<T>& allocator) : _values(allocator) {}
+
+template <typename T>
+ValueSegment<T>::ValueSegment(ValueVector<T>&& values) : _values(std::move(values)) {}
+
 template <typename T>
 const AllTypeVariant ValueSegment<T>::operator[](const size_t offset) const {
   PerformanceWarning("operator[] used");
-  return _values[offset];
+  return T{_values[offset]};
 }
 
 template <typename T>
@@ -30,7 +37,12 @@ size_t ValueSegment<T>::size() const {
 }
 
 template <typename T>
-const std::vector<T>& ValueSegment<T>::values() const {
+size_t ValueSegment<T>::estimate_memory_usage() const {
+  return sizeof(*this) + vector_heap_size(_values);
+}
+
+template <typename T>
+const ValueVector<T>& ValueSegment<T>::values() const {
   return _values;
 }
 
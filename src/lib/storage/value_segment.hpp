@@ -6,13 +6,21 @@
 #include <vector>
 
 #include "base_segment.hpp"
+#include "value_vector.hpp"
 
 namespace opossum {
 
 // ValueSegment is a segment type that stores all its values in a vector
+// strings are stored contiguously in a StringVector and accessed as std::string_views (see ValueVector)
 template <typename T>
 class ValueSegment : public BaseSegment {
  public:
+  // the values are allocated using the given allocator, which uses the default memory resource if none is passed
+  explicit ValueSegment(const PolymorphicAllocator<T>& allocator = {});
+
+  // creates a segment that takes ownership of already materialized values, e.g., when importing a table
+  explicit ValueSegment(ValueVector<T>&& values);
+
   // return the value at a certain position. If you want to write efficient operators, back off!
   const AllTypeVariant operator[](const size_t i) const override;
 
@@ -22,14 +30,17 @@ class ValueSegment : public BaseSegment {
   // return the number of entries
   size_t size() const override;
 
+  // includes the heap allocations of strings that do not fit into the small string buffer
+  size_t estimate_memory_usage() const override;
+
   // Return all values. This is the preferred method to check a value at a certain index. Usually you need to
   // access more than a single value anyway.
   // e.g. const auto& values = value_segment.values(); and then: values.at(i); in your loop.
-  const std::vector<T>& values() const;
+  const ValueVector<T>& values() const;
 
  protected:
   // stores the values of the segment
-  std::vector<T> _values;
+  ValueVector<T> _values;
 };
 
 }  // namespace opossum
@@ -0,0 +1,178 @@
+#pragma once
+
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+/**
+ * Stores strings contiguously: the characters of all strings in one buffer and the end offset of each string in a
+ * second one. A vector of n strings therefore needs two allocations instead of up to n + 1, there is no per-string
+ * overhead for the std::string objects, and reading the strings in order touches consecutive memory.
+ *
+ * The strings are accessed as std::string_views, which remain valid until the vector is modified. Apart from that, the
+ * interface follows std::vector, so that segments can use it in place of a vector of strings (see ValueVector).
+ */
+class StringVector {
+ public:
+  using value_type = std::string_view;
+  using size_type = size_t;
+  using difference_type = std::ptrdiff_t;
+  using allocator_type = PolymorphicAllocator<char>;
+
+  // random access iterator that returns the strings by value (i.e., as string_views)
+  class Iterator {
+   public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = std::string_view;
+    using difference_type = std::ptrdiff_t;
+    using pointer = void;
+    using reference = std::string_view;
+
+    Iterator() = default;
+    Iterator(const StringVector* vector, const size_t index) : _vector(vector), _index(index) {}
+
+    std::string_view operator*() const { return (*_vector)[_index]; }
+    std::string_view operator[](const difference_type offset) const { return (*_vector)[_index + offset]; }
+
+    Iterator& operator++() {
+      ++_index;
+      return *this;
+    }
+    Iterator operator++(int) { return Iterator{_vector, _index++}; }
+    Iterator& operator--() {
+      --_index;
+      return *this;
+    }
+    Iterator operator--(int) { return Iterator{_vector, _index--}; }
+    Iterator& operator+=(const difference_type offset) {
+      _index += offset;
+      return *this;
+    }
+    Iterator& operator-=(const difference_type offset) {
+      _index -= offset;
+      return *this;
+    }
+    Iterator operator+(const difference_type offset) const { return Iterator{_vector, _index + offset}; }
+    Iterator operator-(const difference_type offset) const { return Iterator{_vector, _index - offset}; }
+    friend Iterator operator+(const difference_type offset, const Iterator& iterator) { return iterator + offset; }
+    difference_type operator-(const Iterator& other) const {
+      return static_cast<difference_type>(_index) - static_cast<difference_type>(other._index);
+    }
+
+    bool operator==(const Iterator& other) const { return _index == other._index; }
+    bool operator!=(const Iterator& other) const { return _index != other._index; }
+    bool operator<(const Iterator& other) const { return _index < other._index; }
+    bool operator<=(const Iterator& other) const { return _index <= other._index; }
+    bool operator>(const Iterator& other) const { return _index > other._index; }
+    bool operator>=(const Iterator& other) const { return _index >= other._index; }
+
+   protected:
+    const StringVector* _vector = nullptr;
+    size_t _index = 0;
+  };
+
+  using iterator = Iterator;
+  using const_iterator = Iterator;
+
+  explicit StringVector(const allocator_type& allocator = {}) : _characters(allocator), _ends(allocator) {}
+
+  StringVector(std::initializer_list<std::string_view> values, const allocator_type& allocator = {})
+      : StringVector(allocator) {
+    for (const auto value : values) push_back(value);
+  }
+
+  // takes ownership of already concatenated characters and the matching end offsets, e.g., when importing a table
+  StringVector(pmr_vector<char>&& characters, pmr_vector<size_t>&& ends)
+      : _characters(std::move(characters)), _ends(std::move(ends)) {
+    DebugAssert(_ends.empty() ? _characters.empty() : _ends.back() == _characters.size(),
+                "end offsets do not match the characters");
+  }
+
+  // copies and moves keep the allocator of the source, as for std::pmr containers
+  StringVector(const StringVector&) = default;
+  StringVector(StringVector&&) = default;
+  StringVector& operator=(const StringVector&) = default;
+  StringVector& operator=(StringVector&&) = default;
+
+  // reserves space for the given number of strings and, optionally, their total number of characters
+  void reserve(const size_t count, const size_t character_count = 0) {
+    _ends.reserve(count);
+    _characters.reserve(character_count);
+  }
+
+  void push_back(const std::string_view value) {
+    _characters.insert(_characters.end(), value.cbegin(), value.cend());
+    _ends.push_back(_characters.size());
+  }
+
+  void emplace_back(const std::string_view value) { push_back(value); }
+
+  std::string_view operator[](const size_t index) const {
+    const auto begin = index == 0 ? size_t{0} : _ends[index - 1];
+    return std::string_view{_characters.data() + begin, _ends[index] - begin};
+  }
+
+  std::string_view at(const size_t index) const {
+    Assert(index < size(), "StringVector: Index out of range");
+    return (*this)[index];
+  }
+
+  std::string_view front() const { return (*this)[0]; }
+  std::string_view back() const { return (*this)[size() - 1]; }
+
+  size_t size() const { return _ends.size(); }
+  bool empty() const { return _ends.empty(); }
+
+  Iterator begin() const { return Iterator{this, 0}; }
+  Iterator end() const { return Iterator{this, size()}; }
+  Iterator cbegin() const { return begin(); }
+  Iterator cend() const { return end(); }
+
+  allocator_type get_allocator() const { return _characters.get_allocator(); }
+
+  // the concatenated characters of all strings and the offset behind the last character of each string
+  const pmr_vector<char>& characters() const { return _characters; }
+  const pmr_vector<size_t>& ends() const { return _ends; }
+
+  bool operator==(const StringVector& other) const { return _ends == other._ends && _characters == other._characters; }
+  bool operator!=(const StringVector& other) const { return !(*this == other); }
+
+ protected:
+  pmr_vector<char> _characters;
+  pmr_vector<size_t> _ends;
+};
+
+// returns the number of bytes allocated by the string vector, excluding the object itself
+inline size_t vector_heap_size(const StringVector& values) {
+  return values.characters().capacity() + values.ends().capacity() * sizeof(size_t);
+}
+
+// The container in which segments store their values: strings are pooled in a StringVector, all other types are
+// stored in a pmr_vector.
+template <typename T>
+struct ValueVectorSelector {
+  using type = pmr_vector<T>;
+};
+
+template <>
+struct ValueVectorSelector<std::string> {
+  using type = StringVector;
+};
+
+template <typename T>
+using ValueVector = typename ValueVectorSelector<T>::type;
+
+// the type in which the values of a ValueVector<T> are accessed, i.e., std::string_view for strings and T otherwise
+template <typename T>
+using ValueView = std::conditional_t<std::is_same_v<T, std::string>, std::string_view, T>;
+
+}  // namespace opossum
@@ -0,0 +1,314 @@
+#include "write_ahead_log.hpp"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+#include "utils/binary_reader.hpp"
+#include "utils/buffered_writer.hpp"
+#include "utils/mapped_file.hpp"
+
+namespace opossum {
+
+// Collects the logged values of one column of a table in their actual type
+class BaseLogColumnBuffer {
+ public:
+  virtual ~BaseLogColumnBuffer() = default;
+
+  virtual void append(const AllTypeVariant& value) = 0;
+
+  // removes the last value, e.g., when another value of the same row cannot be converted
+  virtual void pop_back() = 0;
+
+  // appends the values in the format of ExportBinary to the given buffer
+  virtual void serialize(std::vector<char>& buffer) const = 0;
+};
+
+namespace {
+
+constexpr auto GROUP_HEADER_SIZE = 2 * sizeof(uint64_t);
+
+void _append_bytes(std::vector<char>& buffer, const char* data, const size_t size) {
+  buffer.insert(buffer.end(), data, data + size);
+}
+
+template <typename T>
+void _append_value(std::vector<char>& buffer, const T& value) {
+  _append_bytes(buffer, reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+uint64_t _checksum(const std::string_view data) {
+  // 64 bit FNV-1a
+  auto hash = uint64_t{14695981039346656037ull};
+  for (const auto character : data) {
+    hash ^= static_cast<uint8_t>(character);
+    hash *= uint64_t{1099511628211ull};
+  }
+  return hash;
+}
+
+template <typename T>
+class LogColumnBuffer : public BaseLogColumnBuffer {
+ public:
+  void append(const AllTypeVariant& value) override { _values.push_back(type_cast<T>(value)); }
+
+  void pop_back() override { _values.pop_back(); }
+
+  void serialize(std::vector<char>& buffer) const override {
+    if constexpr (std::is_same_v<T, std::string>) {
+      for (const auto& value : _values) {
+        DebugAssert(value.size() <= std::numeric_limits<uint32_t>::max(), "string is too long");
+        _append_value(buffer, static_cast<uint32_t>(value.size()));
+      }
+      for (const auto& value : _values) {
+        _append_bytes(buffer, value.data(), value.size());
+      }
+    } else {
+      _append_bytes(buffer, reinterpret_cast<const char*>(_values.data()), _values.size() * sizeof(T));
+    }
+  }
+
+ protected:
+  std::vector<T> _values;
+};
+
+// Calls the given function for the payload of every complete group with a valid checksum, starting at the beginning
+// of the log. Returns the size of the log up to the end of the last such group.
+size_t _for_each_group(const std::string_view log, const std::function<void(std::string_view)>& function) {
+  auto offset = size_t{0};
+  while (log.size() - offset >= GROUP_HEADER_SIZE) {
+    auto payload_size = uint64_t{0};
+    auto checksum = uint64_t{0};
+    std::memcpy(&payload_size, log.data() + offset, sizeof(uint64_t));
+    std::memcpy(&checksum, log.data() + offset + sizeof(uint64_t), sizeof(uint64_t));
+    if (log.size() - offset - GROUP_HEADER_SIZE < payload_size) break;
+
+    const auto payload = log.substr(offset + GROUP_HEADER_SIZE, payload_size);
+    if (_checksum(payload) != checksum) break;
+
+    function(payload);
+    offset += GROUP_HEADER_SIZE + payload_size;
+  }
+  return offset;
+}
+
+// opens the log for appending and cuts off a group that was only partially written before a crash
+int _open_log(const std::string& file_name) {
+  const auto file_descriptor = open(file_name.c_str(), O_WRONLY | O_CREAT | O_APPEND, 0644);
+  Assert(file_descriptor >= 0, "WriteAheadLog: Could not open file " + file_name);
+
+  const MappedFile file(file_name);
+  const auto valid_size = _for_each_group(file.view(), [](std::string_view) {});
+  if (valid_size < file.size()) {
+    Assert(ftruncate(file_descriptor, static_cast<off_t>(valid_size)) == 0,
+           "WriteAheadLog: Could not truncate file " + file_name);
+  }
+  return file_descriptor;
+}
+
+}  // namespace
+
+WriteAheadLog::WriteAheadLog(const std::string& file_name, const size_t group_commit_rows,
+                             const std::chrono::microseconds group_commit_interval, const bool synchronous_commit)
+    : _file_descriptor(_open_log(file_name)),
+      _group_commit_rows(group_commit_rows),
+      _group_commit_interval(group_commit_interval),
+      _synchronous_commit(synchronous_commit),
+      _flush_thread(&WriteAheadLog::_flush_loop, this) {
+  DebugAssert(group_commit_rows > 0, "group commit rows must be > 0");
+}
+
+WriteAheadLog::~WriteAheadLog() {
+  {
+    std::lock_guard lock(_mutex);
+    _shutdown = true;
+  }
+  _group_condition.notify_one();
+  _flush_thread.join();
+  close(_file_descriptor);
+}
+
+uint64_t WriteAheadLog::log_append(const std::string& table_name, const Table& table, const uint64_t row_index,
+                                   const std::vector<AllTypeVariant>& values) {
+  std::lock_guard lock(_mutex);
+  Assert(_error.empty(), "WriteAheadLog: " + _error);
+
+  // a record holds consecutive rows of a table, rows that do not follow the last record of the table start a new one
+  auto record = std::find_if(_pending_records.rbegin(), _pending_records.rend(), [&](const auto& pending_record) {
+    return pending_record.table_name == table_name;
+  });
+  if (record == _pending_records.rend() || record->first_row_index + record->row_count != row_index) {
+    auto columns = std::vector<std::unique_ptr<BaseLogColumnBuffer>>{};
+    for (ColumnID column_id{0}; column_id < table.column_count(); ++column_id) {
+      columns.push_back(make_unique_by_data_type<BaseLogColumnBuffer, LogColumnBuffer>(table.column_type(column_id)));
+    }
+    _pending_records.push_back(PendingRecord{table_name, row_index, std::move(columns), 0});
+    record = _pending_records.rbegin();
+  }
+
+  // the row is rejected as a whole if one of its values does not fit its column, so that the table does not insert it
+  Assert(values.size() == record->columns.size(), "wrong number of items in logged row");
+  auto column_index = size_t{0};
+  try {
+    for (; column_index < values.size(); ++column_index) {
+      record->columns[column_index]->append(values[column_index]);
+    }
+  } catch (...) {
+    for (auto appended_column_index = size_t{0}; appended_column_index < column_index; ++appended_column_index) {
+      record->columns[appended_column_index]->pop_back();
+    }
+    if (record->row_count == 0) _pending_records.erase(std::next(record).base());
+    throw;
+  }
+  ++record->row_count;
+  ++_pending_row_count;
+
+  if (_pending_row_count >= _group_commit_rows) _group_condition.notify_one();
+  return _next_group_id;
+}
+
+void WriteAheadLog::commit(const uint64_t group_id) {
+  if (!_synchronous_commit) return;
+  std::unique_lock lock(_mutex);
+  _wait_until_durable(lock, group_id);
+}
+
+void WriteAheadLog::flush() {
+  std::unique_lock lock(_mutex);
+  _wait_until_durable(lock, _pending_row_count > 0 ? _next_group_id : _next_group_id - 1);
+}
+
+void WriteAheadLog::_wait_until_durable(std::unique_lock<std::mutex>& lock, const uint64_t group_id) {
+  ++_waiting_appender_count;
+  _group_condition.notify_one();
+  _durable_condition.wait(lock, [&]() { return _durable_group_id >= group_id || !_error.empty(); });
+  --_waiting_appender_count;
+  Assert(_durable_group_id >= group_id, "WriteAheadLog: " + _error);
+}
+
+void WriteAheadLog::_flush_loop() {
+  std::unique_lock lock(_mutex);
+  while (true) {
+    // after the interval has passed, the pending rows are written regardless of how many there are
+    _group_condition.wait_for(lock, _group_commit_interval, [&]() {
+      return _shutdown || _pending_row_count >= _group_commit_rows ||
+             (_waiting_appender_count > 0 && _pending_row_count > 0);
+    });
+
+    if (_pending_row_count == 0) {
+      if (_shutdown) return;
+      continue;
+    }
+
+    // rows that are appended while the group is written belong to the next group
+    const auto records = std::move(_pending_records);
+    _pending_records.clear();
+    _pending_row_count = 0;
+    const auto group_id = _next_group_id++;
+    lock.unlock();
+
+    // errors are reported to the waiting threads, because an exception would terminate the background thread
+    auto error = std::string{};
+    try {
+      // the group is serialized completely, so that it is written directly instead of through a BufferedWriter
+      const auto group = _serialize_group(records);
+      BufferedWriter::write_to_file(_file_descriptor, group.data(), group.size());
+      if (fdatasync(_file_descriptor) != 0) error = "Could not sync log";
+    } catch (const std::exception& exception) {
+      error = exception.what();
+    }
+
+    lock.lock();
+    if (!error.empty()) {
+      _error = error;
+      _durable_condition.notify_all();
+      return;
+    }
+    _durable_group_id = group_id;
+    _durable_condition.notify_all();
+  }
+}
+
+std::vector<char> WriteAheadLog::_serialize_group(const std::vector<PendingRecord>& records) const {
+  // the header is filled in once the payload is complete
+  auto group = std::vector<char>(GROUP_HEADER_SIZE);
+  _append_value(group, static_cast<uint32_t>(records.size()));
+  for (const auto& record : records) {
+    _append_value(group, static_cast<uint32_t>(record.table_name.size()));
+    _append_bytes(group, record.table_name.data(), record.table_name.size());
+    _append_value(group, record.first_row_index);
+    _append_value(group, record.row_count);
+    _append_value(group, static_cast<uint16_t>(record.columns.size()));
+    for (const auto& column : record.columns) {
+      column->serialize(group);
+    }
+  }
+
+  const auto payload_size = static_cast<uint64_t>(group.size() - GROUP_HEADER_SIZE);
+  const auto checksum = _checksum(std::string_view{group.data() + GROUP_HEADER_SIZE, payload_size});
+  std::memcpy(group.data(), &payload_size, sizeof(uint64_t));
+  std::memcpy(group.data() + sizeof(uint64_t), &checksum, sizeof(uint64_t));
+  return group;
+}
+
+uint64_t WriteAheadLog::replay(const std::string& file_name) {
+  // there is nothing to replay if nothing has been logged before
+  if (access(file_name.c_str(), F_OK) != 0) return 0;
+
+  const MappedFile file(file_name);
+  auto replayed_row_count = uint64_t{0};
+  _for_each_group(file.view(), [&](const std::string_view payload) {
+    BinaryReader reader(payload);
+    const auto record_count = reader.read_value<uint32_t>();
+    for (auto record_id = uint32_t{0}; record_id < record_count; ++record_id) {
+      const auto table_name = reader.read_string();
+      const auto first_row_index = reader.read_value<uint64_t>();
+      const auto row_count = reader.read_value<uint32_t>();
+      const auto column_count = reader.read_value<uint16_t>();
+
+      const auto table = StorageManager::get().get_table(table_name);
+      Assert(table->column_count() == column_count, "WriteAheadLog: Logged row does not match table " + table_name);
+      Assert(first_row_index <= table->row_count(),
+             "WriteAheadLog: Rows before the logged ones are missing in table " + table_name);
+
+      auto rows = std::vector<std::vector<AllTypeVariant>>(row_count, std::vector<AllTypeVariant>(column_count));
+      for (ColumnID column_id{0}; column_id < column_count; ++column_id) {
+        resolve_data_type(table->column_type(column_id), [&](auto type) {
+          using Type = typename decltype(type)::type;
+          const auto values = reader.read_values<Type>(row_count);
+          for (auto row = uint32_t{0}; row < row_count; ++row) {
+            rows[row][column_id] = Type{values[row]};
+          }
+        });
+      }
+
+      // rows that the table already contains, e.g., from a checkpoint, are skipped
+      for (auto row_index = table->row_count() - first_row_index; row_index < row_count; ++row_index) {
+        table->append(std::move(rows[row_index]));
+        ++replayed_row_count;
+      }
+    }
+    Assert(reader.at_end(), "WriteAheadLog: Unexpected data in log " + file_name);
+  });
+  return replayed_row_count;
+}
+
+}  // namespace opossum
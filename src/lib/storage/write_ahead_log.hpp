@@ -0,0 +1,116 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseLogColumnBuffer;
+class Table;
+
+/**
+ * Optional durability layer for Table::append. Rows appended to a table that has a log (see
+ * Table::set_write_ahead_log) are added to the log while the table is locked, right before they are inserted, so
+ * that the log contains the rows of a table in the order of the table. Along with the rows, the log stores their
+ * positions in the table. Rows that the log rejects, because their values do not fit the columns or because the log
+ * has failed, are not inserted.
+ *
+ * Group commit: appended rows are collected in memory, column by column per table. A background thread writes all
+ * collected rows as one group and calls fdatasync once per group. A group is written as soon as
+ *  - group_commit_rows rows have been collected,
+ *  - group_commit_interval has passed since the last group, or
+ *  - an appending thread waits for its rows to become durable (synchronous commit).
+ * With synchronous commit, Table::append returns only after the row is durable; concurrent appenders share one
+ * fdatasync. Other threads may see the row before, though. Without synchronous commit, Table::append returns
+ * immediately and a crash loses at most the rows of the last group_commit_interval.
+ *
+ * If writing or syncing the log fails, the error is reported to the threads that wait for their rows (see commit and
+ * flush), and all further rows are rejected.
+ *
+ * After a restart, the tables have to be registered in the StorageManager (e.g., via StorageManager::restore) before
+ * replay() appends the logged rows to them. Rows whose positions the table already contains, e.g., because they were
+ * part of the checkpoint that was restored, are skipped. replay() has to be called before logging is enabled for the
+ * tables again, otherwise the replayed rows are logged a second time.
+ *
+ * Every group is written with its size and a checksum so that a group that was only partially written during a crash
+ * is detected. Replay stops there, and opening the log for writing cuts it off.
+ *
+ * Group format: uint64_t payload size, uint64_t checksum (FNV-1a) of the payload, payload
+ * Payload:      uint32_t record count, records
+ * Record:       table name (uint32_t length, characters), uint64_t position of the first row in the table,
+ *               uint32_t row count, uint16_t column count, one value list per column as in the format of ExportBinary
+ */
+class WriteAheadLog : private Noncopyable {
+ public:
+  explicit WriteAheadLog(const std::string& file_name, const size_t group_commit_rows = 4096,
+                         const std::chrono::microseconds group_commit_interval = std::chrono::milliseconds{10},
+                         const bool synchronous_commit = false);
+
+  // writes all rows that have not been written yet
+  ~WriteAheadLog();
+
+  // adds a row that is about to be appended to the given table at the given position to the current group and returns
+  // the id of the group, has to be called while the table is locked
+  // throws without logging anything if the log has failed or if a value cannot be converted to the type of its column
+  uint64_t log_append(const std::string& table_name, const Table& table, uint64_t row_index,
+                      const std::vector<AllTypeVariant>& values);
+
+  // blocks until the group with the given id has been written if synchronous commit is enabled
+  void commit(uint64_t group_id);
+
+  // blocks until all rows that have been logged so far are durable
+  void flush();
+
+  // Appends the rows of the given log that the tables in the StorageManager do not contain yet and returns the number
+  // of replayed rows. Rows at positions that the tables already contain are skipped.
+  static uint64_t replay(const std::string& file_name);
+
+ protected:
+  // rows of one table in the current group
+  struct PendingRecord {
+    std::string table_name;
+    uint64_t first_row_index;
+    std::vector<std::unique_ptr<BaseLogColumnBuffer>> columns;
+    uint32_t row_count = 0;
+  };
+
+  void _flush_loop();
+
+  // blocks until the group with the given id has been written, the lock must hold _mutex
+  void _wait_until_durable(std::unique_lock<std::mutex>& lock, uint64_t group_id);
+  std::vector<char> _serialize_group(const std::vector<PendingRecord>& records) const;
+
+  const int _file_descriptor;
+  const size_t _group_commit_rows;
+  const std::chrono::microseconds _group_commit_interval;
+  const bool _synchronous_commit;
+
+  // protects all of the following members
+  std::mutex _mutex;
+  std::condition_variable _group_condition;
+  std::condition_variable _durable_condition;
+
+  std::vector<PendingRecord> _pending_records;
+  size_t _pending_row_count = 0;
+
+  // the current group gets the id _next_group_id, groups up to _durable_group_id have been written
+  uint64_t _next_group_id = 1;
+  uint64_t _durable_group_id = 0;
+  size_t _waiting_appender_count = 0;
+  bool _shutdown = false;
+
+  // the error that occurred while writing the log, if any
+  std::string _error;
+
+  std::thread _flush_thread;
+};
+
+}  // namespace opossum
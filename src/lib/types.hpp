@@ -3,6 +3,7 @@
 #include <cstdint>
 #include <iostream>
 #include <limits>
+#include <memory_resource>
 #include <string>
 #include <tuple>
 #include <vector>
@@ -31,12 +32,23 @@
 STRONG_TYPEDEF(uint32_t, ChunkID);
 STRONG_TYPEDEF(uint16_t, ColumnID);
 STRONG_TYPEDEF(uint32_t, ValueID);  // Cannot be larger than ChunkOffset
+STRONG_TYPEDEF(uint32_t, NodeID);   // identifies a NUMA node of the Topology
 
 namespace opossum {
 
+// Segments, attribute vectors and position lists use polymorphic allocators, so that their memory can come from a
+// different memory resource than the default heap, e.g., from the QueryArena for intermediate results.
+template <typename T>
+using PolymorphicAllocator = std::pmr::polymorphic_allocator<T>;
+
+template <typename T>
+using pmr_vector = std::vector<T, PolymorphicAllocator<T>>;
+
 using ChunkOffset = uint32_t;
 using AttributeVectorWidth = uint8_t;
 
+constexpr NodeID UNKNOWN_NODE_ID{std::numeric_limits<NodeID::base_type>::max()};
+
 struct RowID {
   ChunkID chunk_id;
   ChunkOffset chunk_offset;
@@ -51,9 +63,25 @@ struct RowID {
   }
 };
 
+constexpr ChunkID INVALID_CHUNK_ID{std::numeric_limits<ChunkID::base_type>::max()};
+
+// determines on which NUMA node each chunk of a table is placed when the chunks are created in parallel
+// RoundRobin assigns consecutive chunks to consecutive nodes, Partitioned assigns each node one contiguous range
+enum class ChunkPlacement { RoundRobin, Partitioned };
+
+// identifies how the values of a segment are stored, e.g., in binary table files
+enum class EncodingType : uint8_t { Unencoded, Dictionary };
+
+// determines whether Table::compress_chunk builds a dictionary for each segment or lets all segments of a column share
+// one dictionary, so that their ValueIDs can be compared across chunks
+enum class DictionaryScope { Chunk, Column };
+
 enum class ScanType { OpEquals, OpNotEquals, OpLessThan, OpLessThanEquals, OpGreaterThan, OpGreaterThanEquals };
 
-using PosList = std::vector<RowID>;
+using PosList = pmr_vector<RowID>;
+
+// positions within a single chunk, which need only half the memory of a PosList
+using ChunkOffsetList = pmr_vector<ChunkOffset>;
 
 class Noncopyable {
  protected:
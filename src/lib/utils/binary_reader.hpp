@@ -0,0 +1,70 @@
+#pragma once
+
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include "storage/value_vector.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+// Reads values in the binary format of ExportBinary front to back from a buffer, e.g., a memory-mapped file, and fails
+// if the buffer is shorter than expected
+class BinaryReader {
+ public:
+  explicit BinaryReader(const std::string_view data) : _position(data.data()), _end(data.data() + data.size()) {}
+
+  template <typename T>
+  T read_value() {
+    auto value = T{};
+    std::memcpy(&value, _consume(sizeof(T)), sizeof(T));
+    return value;
+  }
+
+  std::string read_string() {
+    const auto length = read_value<uint32_t>();
+    return std::string(_consume(length), length);
+  }
+
+  // reads a list of values, which is a contiguous array for fixed-width types, and an array of lengths followed by
+  // the concatenated characters for strings, which are copied into a StringVector at once
+  template <typename T>
+  ValueVector<T> read_values(const size_t count, const PolymorphicAllocator<T>& allocator = {}) {
+    if constexpr (std::is_same_v<T, std::string>) {
+      const auto lengths = read_values<uint32_t>(count);
+      auto ends = pmr_vector<size_t>(allocator);
+      ends.reserve(count);
+      auto character_count = size_t{0};
+      for (const auto length : lengths) {
+        character_count += length;
+        ends.push_back(character_count);
+      }
+      auto characters = pmr_vector<char>(character_count, allocator);
+      std::memcpy(characters.data(), _consume(character_count), character_count);
+      return StringVector(std::move(characters), std::move(ends));
+    } else {
+      auto values = pmr_vector<T>(count, allocator);
+      std::memcpy(values.data(), _consume(count * sizeof(T)), count * sizeof(T));
+      return values;
+    }
+  }
+
+  bool at_end() const { return _position == _end; }
+
+ protected:
+  const char* _consume(const size_t bytes) {
+    Assert(static_cast<size_t>(_end - _position) >= bytes, "BinaryReader: Unexpected end of data");
+    const auto begin = _position;
+    _position += bytes;
+    return begin;
+  }
+
+  const char* _position;
+  const char* const _end;
+};
+
+}  // namespace opossum
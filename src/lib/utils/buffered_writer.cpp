@@ -0,0 +1,53 @@
+#include "buffered_writer.hpp"
+
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#include <string>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+BufferedWriter::BufferedWriter(const int file_descriptor, const size_t buffer_size)
+    : _file_descriptor(file_descriptor), _buffer(buffer_size) {
+  DebugAssert(buffer_size > 0, "buffer size must be > 0");
+}
+
+void BufferedWriter::write(const char* data, const size_t size) {
+  if (_buffer_used + size > _buffer.size()) {
+    flush();
+
+    // large writes would only be copied around, so they bypass the buffer
+    if (size >= _buffer.size()) {
+      _write_to_file(data, size);
+      return;
+    }
+  }
+
+  std::memcpy(_buffer.data() + _buffer_used, data, size);
+  _buffer_used += size;
+}
+
+void BufferedWriter::flush() {
+  _write_to_file(_buffer.data(), _buffer_used);
+  _buffer_used = 0;
+}
+
+void BufferedWriter::_write_to_file(const char* data, const size_t size) {
+  write_to_file(_file_descriptor, data, size);
+}
+
+void BufferedWriter::write_to_file(const int file_descriptor, const char* data, size_t size) {
+  // write may write fewer bytes than requested or be interrupted by a signal, in both cases we have to try again
+  while (size > 0) {
+    const auto written = ::write(file_descriptor, data, size);
+    if (written < 0 && errno == EINTR) continue;
+    Assert(written > 0, "BufferedWriter: Could not write to file: " + std::string{std::strerror(errno)});
+    data += written;
+    size -= static_cast<size_t>(written);
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <string_view>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+// Collects small writes in a large buffer and passes them on to a file descriptor in few, large write calls.
+// Buffered data is only written when the buffer is full or flush() is called, so flush() has to be called before the
+// writer is destroyed. The file descriptor is not closed by the writer.
+class BufferedWriter : private Noncopyable {
+ public:
+  static constexpr size_t DEFAULT_BUFFER_SIZE = 4 * 1024 * 1024;
+
+  explicit BufferedWriter(const int file_descriptor, const size_t buffer_size = DEFAULT_BUFFER_SIZE);
+
+  void write(const char* data, const size_t size);
+
+  void write(const std::string_view data) { write(data.data(), data.size()); }
+
+  // writes the binary representation of a value with a fixed width
+  template <typename T>
+  void write_value(const T& value) {
+    write(reinterpret_cast<const char*>(&value), sizeof(T));
+  }
+
+  // writes all buffered data to the file descriptor
+  void flush();
+
+  // writes data that is already complete in memory to the file descriptor without buffering it, retrying short and
+  // interrupted writes
+  static void write_to_file(int file_descriptor, const char* data, size_t size);
+
+ protected:
+  void _write_to_file(const char* data, size_t size);
+
+  const int _file_descriptor;
+  std::vector<char> _buffer;
+  size_t _buffer_used = 0;
+};
+
+}  // namespace opossum
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <unistd.h>
+
+#include "types.hpp"
+
+namespace opossum {
+
+// Closes a file descriptor when it goes out of scope, e.g., when writing a file fails with an exception. Files that
+// have been written successfully should be closed explicitly with close(), whose result reports errors of delayed
+// writes.
+class FileDescriptorGuard : private Noncopyable {
+ public:
+  explicit FileDescriptorGuard(const int file_descriptor) : _file_descriptor(file_descriptor) {}
+
+  ~FileDescriptorGuard() {
+    if (_file_descriptor >= 0) ::close(_file_descriptor);
+  }
+
+  // closes the file descriptor and returns the result of close()
+  int close() {
+    const auto result = ::close(_file_descriptor);
+    _file_descriptor = -1;
+    return result;
+  }
+
+ protected:
+  int _file_descriptor;
+};
+
+}  // namespace opossum
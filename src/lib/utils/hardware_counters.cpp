@@ -0,0 +1,117 @@
+#include "hardware_counters.hpp"
+
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <array>
+#include <atomic>
+#include <cstring>
+
+namespace opossum {
+
+namespace {
+
+std::atomic<bool> counters_enabled{false};
+// set once opening the counters has failed, so that other threads do not try again
+std::atomic<bool> unsupported{false};
+
+constexpr std::array<uint64_t, 4> EVENTS = {PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+                                            PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_BRANCH_MISSES};
+
+// The counters of a thread form one group, so that they are scheduled onto the CPU's counter registers together and
+// can be read with a single system call. The file descriptors are closed when the thread exits.
+class ThreadCounters {
+ public:
+  ~ThreadCounters() {
+    for (const auto file_descriptor : _file_descriptors) {
+      if (file_descriptor != -1) close(file_descriptor);
+    }
+  }
+
+  HardwareCounterValues read() {
+    if (!_is_open && !_open()) return {};
+
+    // layout for PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING
+    struct {
+      uint64_t event_count;
+      uint64_t time_enabled;
+      uint64_t time_running;
+      uint64_t values[EVENTS.size()];
+    } data;
+    if (::read(_file_descriptors[0], &data, sizeof(data)) != sizeof(data) || data.time_running == 0) return {};
+
+    // if the group had to share the registers with other groups, the values are extrapolated to the whole time
+    const auto scale = [&](const uint64_t value) {
+      if (data.time_running == data.time_enabled) return value;
+      return static_cast<uint64_t>(static_cast<double>(value) * static_cast<double>(data.time_enabled) /
+                                   static_cast<double>(data.time_running));
+    };
+    return HardwareCounterValues{true, scale(data.values[0]), scale(data.values[1]), scale(data.values[2]),
+                                 scale(data.values[3])};
+  }
+
+ protected:
+  bool _open() {
+    if (unsupported) return false;
+
+    for (auto event_index = size_t{0}; event_index < EVENTS.size(); ++event_index) {
+      perf_event_attr attributes;
+      std::memset(&attributes, 0, sizeof(attributes));
+      attributes.size = sizeof(attributes);
+      attributes.type = PERF_TYPE_HARDWARE;
+      attributes.config = EVENTS[event_index];
+      attributes.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+      attributes.exclude_kernel = 1;
+      attributes.exclude_hv = 1;
+
+      const auto group_file_descriptor = event_index == 0 ? -1 : _file_descriptors[0];
+      _file_descriptors[event_index] =
+          static_cast<int>(syscall(SYS_perf_event_open, &attributes, 0, -1, group_file_descriptor, 0));
+      if (_file_descriptors[event_index] == -1) {
+        unsupported = true;
+        return false;
+      }
+    }
+    _is_open = true;
+    return true;
+  }
+
+  std::array<int, EVENTS.size()> _file_descriptors{-1, -1, -1, -1};
+  bool _is_open = false;
+};
+
+}  // namespace
+
+HardwareCounterValues& HardwareCounterValues::operator+=(const HardwareCounterValues& other) {
+  if (!other.available) return *this;
+  available = true;
+  cycles += other.cycles;
+  instructions += other.instructions;
+  llc_misses += other.llc_misses;
+  branch_misses += other.branch_misses;
+  return *this;
+}
+
+HardwareCounterValues HardwareCounterValues::operator-(const HardwareCounterValues& other) const {
+  if (!available || !other.available) return {};
+  // extrapolated values (see ThreadCounters::read) can decrease slightly
+  const auto difference = [](const uint64_t minuend, const uint64_t subtrahend) {
+    return minuend > subtrahend ? minuend - subtrahend : uint64_t{0};
+  };
+  return HardwareCounterValues{true, difference(cycles, other.cycles), difference(instructions, other.instructions),
+                               difference(llc_misses, other.llc_misses),
+                               difference(branch_misses, other.branch_misses)};
+}
+
+void HardwareCounters::set_enabled(const bool enabled) { counters_enabled = enabled; }
+
+bool HardwareCounters::is_enabled() { return counters_enabled; }
+
+HardwareCounterValues HardwareCounters::read() {
+  if (!counters_enabled || unsupported) return {};
+  thread_local ThreadCounters thread_counters;
+  return thread_counters.read();
+}
+
+}  // namespace opossum
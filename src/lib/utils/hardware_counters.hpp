@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cstdint>
+
+namespace opossum {
+
+// Values of the hardware performance counters of a thread. The values are only meaningful if available is set, i.e.,
+// if the counters were enabled and could be opened (see HardwareCounters).
+struct HardwareCounterValues {
+  bool available = false;
+  uint64_t cycles = 0;
+  uint64_t instructions = 0;
+  // misses in the last level cache
+  uint64_t llc_misses = 0;
+  uint64_t branch_misses = 0;
+
+  // adds the values of other, if they are available
+  HardwareCounterValues& operator+=(const HardwareCounterValues& other);
+
+  // returns the difference between two readings, which is only available if both are
+  HardwareCounterValues operator-(const HardwareCounterValues& other) const;
+};
+
+// Optional instrumentation with the hardware performance counters of the CPU, which tell, e.g., whether an operator
+// is bound by cache or branch misses. The counters are read with Linux' perf_event_open and only count events of the
+// calling thread in user space. Every thread opens its counters when it first reads them.
+//
+// The measurement is disabled by default, so that threads do not open counters unless someone is interested in them.
+// If perf_event_open is not permitted (e.g., in containers or because of /proc/sys/kernel/perf_event_paranoid) or the
+// CPU does not provide the counters (e.g., in virtual machines), the values are simply not available.
+class HardwareCounters {
+ public:
+  // enables or disables the measurement for all threads
+  static void set_enabled(bool enabled);
+  static bool is_enabled();
+
+  // returns the current values of the counters of the calling thread
+  static HardwareCounterValues read();
+};
+
+}  // namespace opossum
@@ -6,10 +6,12 @@
 #include <vector>
 
 #include "storage/table.hpp"
+#include "utils/tracing.hpp"
 
 namespace opossum {
 
 std::shared_ptr<Table> load_table(const std::string& file_name, size_t chunk_size) {
+  TRACE_SPAN("loading", "load_table", file_name);
   std::ifstream infile(file_name);
   Assert(infile.is_open(), "load_table: Could not find file " + file_name);
 
@@ -0,0 +1,56 @@
+#include "mapped_file.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <string>
+#include <string_view>
+
+#include "utils/assert.hpp"
+#include "utils/performance_warning.hpp"
+
+namespace opossum {
+
+MappedFile::MappedFile(const std::string& file_name) {
+  const auto file_descriptor = open(file_name.c_str(), O_RDONLY);
+  Assert(file_descriptor >= 0, "MappedFile: Could not open file " + file_name);
+
+  struct stat file_stat;
+  const auto stat_result = fstat(file_descriptor, &file_stat);
+  if (stat_result != 0) close(file_descriptor);
+  Assert(stat_result == 0, "MappedFile: Could not determine size of file " + file_name);
+  _size = static_cast<size_t>(file_stat.st_size);
+
+  // mmap does not accept empty mappings, so empty files are represented by a nullptr
+  if (_size > 0) {
+    _data = mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, file_descriptor, 0);
+  }
+  // the mapping stays valid after the file descriptor has been closed
+  close(file_descriptor);
+  Assert(_data != MAP_FAILED, "MappedFile: Could not map file " + file_name);
+
+  if (_size > 0) {
+    // The importers read the file front to back exactly once. The advice values are not flags and have to be given
+    // separately. As they are only hints, the file can still be read if the kernel rejects them, just more slowly.
+    if (madvise(_data, _size, MADV_SEQUENTIAL) != 0) {
+      PerformanceWarning("MappedFile: madvise(MADV_SEQUENTIAL) failed, the file is read without read-ahead hints");
+    }
+    if (madvise(_data, _size, MADV_WILLNEED) != 0) {
+      PerformanceWarning("MappedFile: madvise(MADV_WILLNEED) failed, the file is not prefetched");
+    }
+  }
+}
+
+MappedFile::~MappedFile() {
+  if (_data && _data != MAP_FAILED) munmap(_data, _size);
+}
+
+const char* MappedFile::data() const { return static_cast<const char*>(_data); }
+
+size_t MappedFile::size() const { return _size; }
+
+std::string_view MappedFile::view() const { return std::string_view{data(), _size}; }
+
+}  // namespace opossum
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+
+#include "types.hpp"
+
+namespace opossum {
+
+// Maps a file read-only into memory for as long as the object lives. Used by the importers to read files without
+// copying them into stream buffers first.
+class MappedFile : private Noncopyable {
+ public:
+  explicit MappedFile(const std::string& file_name);
+  ~MappedFile();
+
+  const char* data() const;
+  size_t size() const;
+
+  // returns the content of the whole file
+  std::string_view view() const;
+
+ protected:
+  void* _data = nullptr;
+  size_t _size = 0;
+};
+
+}  // namespace opossum
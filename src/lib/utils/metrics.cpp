@@ -0,0 +1,230 @@
+#include "metrics.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+void add_to_atomic(std::atomic<double>& value, const double amount) {
+  auto expected = value.load(std::memory_order_relaxed);
+  while (!value.compare_exchange_weak(expected, expected + amount, std::memory_order_relaxed)) {
+  }
+}
+
+std::string format_value(const double value) {
+  if (std::isinf(value)) return value > 0 ? "+Inf" : "-Inf";
+  if (std::isnan(value)) return "NaN";
+  auto stream = std::ostringstream{};
+  stream << std::setprecision(std::numeric_limits<double>::max_digits10) << value;
+  return stream.str();
+}
+
+std::string escape_label_value(const std::string& value) {
+  auto escaped = std::string{};
+  for (const auto character : value) {
+    if (character == '\\' || character == '"') {
+      escaped += '\\';
+      escaped += character;
+    } else if (character == '\n') {
+      escaped += "\\n";
+    } else {
+      escaped += character;
+    }
+  }
+  return escaped;
+}
+
+// formats labels as {name="value",...}, or as an empty string if there are none
+std::string format_labels(const MetricLabels& labels) {
+  if (labels.empty()) return "";
+  auto formatted = std::string{"{"};
+  for (const auto& [name, value] : labels) {
+    if (formatted.size() > 1) formatted += ',';
+    formatted += name + "=\"" + escape_label_value(value) + "\"";
+  }
+  return formatted + "}";
+}
+
+const char* type_name(const MetricType type) {
+  switch (type) {
+    case MetricType::Counter:
+      return "counter";
+    case MetricType::Gauge:
+      return "gauge";
+    case MetricType::Histogram:
+      return "histogram";
+  }
+  Fail("unknown metric type");
+  return "";
+}
+
+}  // namespace
+
+void Gauge::add(const double amount) { add_to_atomic(_value, amount); }
+
+Histogram::Histogram(std::vector<double> bucket_bounds)
+    : _bucket_bounds(std::move(bucket_bounds)),
+      _bucket_counts(std::make_unique<std::atomic<uint64_t>[]>(_bucket_bounds.size() + 1)) {
+  DebugAssert(std::is_sorted(_bucket_bounds.cbegin(), _bucket_bounds.cend()), "bucket bounds must be sorted");
+}
+
+void Histogram::observe(const double value) {
+  const auto bucket_index =
+      std::distance(_bucket_bounds.cbegin(), std::lower_bound(_bucket_bounds.cbegin(), _bucket_bounds.cend(), value));
+  _bucket_counts[bucket_index].fetch_add(1, std::memory_order_relaxed);
+  add_to_atomic(_sum, value);
+}
+
+const std::vector<double>& Histogram::bucket_bounds() const { return _bucket_bounds; }
+
+std::vector<uint64_t> Histogram::cumulative_bucket_counts() const {
+  auto counts = std::vector<uint64_t>(_bucket_bounds.size() + 1);
+  auto cumulative_count = uint64_t{0};
+  for (auto bucket_index = size_t{0}; bucket_index < counts.size(); ++bucket_index) {
+    cumulative_count += _bucket_counts[bucket_index].load(std::memory_order_relaxed);
+    counts[bucket_index] = cumulative_count;
+  }
+  return counts;
+}
+
+uint64_t Histogram::count() const { return cumulative_bucket_counts().back(); }
+
+double Histogram::sum() const { return _sum.load(std::memory_order_relaxed); }
+
+const std::vector<double> MetricsRegistry::DEFAULT_LATENCY_BUCKETS = {
+    0.00001, 0.00005, 0.0001, 0.0005, 0.001, 0.005, 0.01, 0.05, 0.1, 0.5, 1.0, 5.0, 10.0};
+
+MetricsRegistry& MetricsRegistry::get() {
+  static MetricsRegistry instance;
+  return instance;
+}
+
+MetricsRegistry::MetricsRegistry() {}
+
+MetricsRegistry::Family& MetricsRegistry::_family(const std::string& name, const std::string& help,
+                                                  const MetricType type) {
+  auto& family = _families[name];
+  if (family.help.empty()) {
+    family.help = help;
+    family.type = type;
+  }
+  Assert(family.type == type, "metric " + name + " is already registered with another type");
+  Assert(!family.collector, "metric " + name + " is already registered with a collector");
+  return family;
+}
+
+Counter& MetricsRegistry::counter(const std::string& name, const std::string& help, const MetricLabels& labels) {
+  std::lock_guard lock(_mutex);
+  auto& counter = _family(name, help, MetricType::Counter).counters[labels];
+  if (!counter) counter = std::make_unique<Counter>();
+  return *counter;
+}
+
+Gauge& MetricsRegistry::gauge(const std::string& name, const std::string& help, const MetricLabels& labels) {
+  std::lock_guard lock(_mutex);
+  auto& gauge = _family(name, help, MetricType::Gauge).gauges[labels];
+  if (!gauge) gauge = std::make_unique<Gauge>();
+  return *gauge;
+}
+
+Histogram& MetricsRegistry::histogram(const std::string& name, const std::string& help, const MetricLabels& labels,
+                                      const std::vector<double>& bucket_bounds) {
+  std::lock_guard lock(_mutex);
+  auto& family = _family(name, help, MetricType::Histogram);
+  if (family.histograms.empty()) family.bucket_bounds = bucket_bounds;
+  auto& histogram = family.histograms[labels];
+  if (!histogram) histogram = std::make_unique<Histogram>(family.bucket_bounds);
+  return *histogram;
+}
+
+void MetricsRegistry::add_collector(const std::string& name, const std::string& help, const MetricType type,
+                                    std::function<std::vector<MetricSample>()> collector) {
+  Assert(type != MetricType::Histogram, "collectors cannot provide histograms");
+  std::lock_guard lock(_mutex);
+  Assert(!_families.count(name), "metric " + name + " is already registered");
+  auto& family = _families[name];
+  family.help = help;
+  family.type = type;
+  family.collector = std::move(collector);
+}
+
+void MetricsRegistry::write_prometheus_text(std::ostream& out) const {
+  // collectors may be slow (e.g., estimating the memory usage of all tables), so they run without blocking the
+  // lookups of metrics; families are never removed, so the collectors stay valid
+  auto collectors = std::vector<std::pair<std::string, std::function<std::vector<MetricSample>()>>>{};
+  {
+    std::lock_guard lock(_mutex);
+    for (const auto& [name, family] : _families) {
+      if (family.collector) collectors.emplace_back(name, family.collector);
+    }
+  }
+  auto collected_samples = std::map<std::string, std::vector<MetricSample>>{};
+  for (const auto& [name, collector] : collectors) {
+    collected_samples[name] = collector();
+  }
+
+  std::lock_guard lock(_mutex);
+  for (const auto& [name, family] : _families) {
+    out << "# HELP " << name << ' ' << family.help << '\n';
+    out << "# TYPE " << name << ' ' << type_name(family.type) << '\n';
+
+    if (family.collector) {
+      for (const auto& sample : collected_samples[name]) {
+        out << name << format_labels(sample.labels) << ' ' << format_value(sample.value) << '\n';
+      }
+      continue;
+    }
+
+    for (const auto& [labels, counter] : family.counters) {
+      out << name << format_labels(labels) << ' ' << counter->value() << '\n';
+    }
+    for (const auto& [labels, gauge] : family.gauges) {
+      out << name << format_labels(labels) << ' ' << format_value(gauge->value()) << '\n';
+    }
+    for (const auto& [labels, histogram] : family.histograms) {
+      const auto counts = histogram->cumulative_bucket_counts();
+      auto bucket_labels = labels;
+      bucket_labels.emplace_back("le", "");
+      for (auto bucket_index = size_t{0}; bucket_index < counts.size(); ++bucket_index) {
+        bucket_labels.back().second = bucket_index < histogram->bucket_bounds().size()
+                                          ? format_value(histogram->bucket_bounds()[bucket_index])
+                                          : "+Inf";
+        out << name << "_bucket" << format_labels(bucket_labels) << ' ' << counts[bucket_index] << '\n';
+      }
+      out << name << "_sum" << format_labels(labels) << ' ' << format_value(histogram->sum()) << '\n';
+      out << name << "_count" << format_labels(labels) << ' ' << counts.back() << '\n';
+    }
+  }
+}
+
+std::string MetricsRegistry::prometheus_text() const {
+  auto stream = std::ostringstream{};
+  write_prometheus_text(stream);
+  return stream.str();
+}
+
+void MetricsRegistry::reset() {
+  std::lock_guard lock(_mutex);
+  for (auto& [name, family] : _families) {
+    for (auto& [labels, counter] : family.counters) counter->_value = 0;
+    for (auto& [labels, gauge] : family.gauges) gauge->_value = 0.0;
+    for (auto& [labels, histogram] : family.histograms) {
+      for (auto bucket_index = size_t{0}; bucket_index <= histogram->_bucket_bounds.size(); ++bucket_index) {
+        histogram->_bucket_counts[bucket_index] = 0;
+      }
+      histogram->_sum = 0.0;
+    }
+  }
+}
+
+}  // namespace opossum
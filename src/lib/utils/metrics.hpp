@@ -0,0 +1,140 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+// the labels of a metric, e.g., {{"operator", "TableScan"}}, which distinguish the metrics of a family
+using MetricLabels = std::vector<std::pair<std::string, std::string>>;
+
+// A value that only increases, e.g., the number of scanned rows.
+class Counter : private Noncopyable {
+ public:
+  void increment(const uint64_t amount = 1) { _value.fetch_add(amount, std::memory_order_relaxed); }
+  uint64_t value() const { return _value.load(std::memory_order_relaxed); }
+
+ protected:
+  friend class MetricsRegistry;
+
+  std::atomic<uint64_t> _value{0};
+};
+
+// A value that can go up and down, e.g., the number of running queries.
+class Gauge : private Noncopyable {
+ public:
+  void set(const double value) { _value.store(value, std::memory_order_relaxed); }
+  void add(double amount);
+  double value() const { return _value.load(std::memory_order_relaxed); }
+
+ protected:
+  friend class MetricsRegistry;
+
+  std::atomic<double> _value{0.0};
+};
+
+// Counts observations, e.g., latencies, in buckets with the given upper bounds, and sums them up.
+class Histogram : private Noncopyable {
+ public:
+  explicit Histogram(std::vector<double> bucket_bounds);
+
+  void observe(double value);
+
+  const std::vector<double>& bucket_bounds() const;
+
+  // returns the number of observations that are less than or equal to each bound, as in the Prometheus format
+  std::vector<uint64_t> cumulative_bucket_counts() const;
+
+  uint64_t count() const;
+  double sum() const;
+
+ protected:
+  friend class MetricsRegistry;
+
+  const std::vector<double> _bucket_bounds;
+  // the last bucket counts the observations above all bounds
+  std::unique_ptr<std::atomic<uint64_t>[]> _bucket_counts;
+  std::atomic<double> _sum{0.0};
+};
+
+enum class MetricType { Counter, Gauge, Histogram };
+
+// a value of a metric that is computed by a collector when the metrics are exported
+struct MetricSample {
+  MetricLabels labels;
+  double value;
+};
+
+/**
+ * The MetricsRegistry is a singleton that holds the metrics of the engine, e.g., the number of rows scanned by
+ * TableScans or the latencies of the operators, and exports them in the text format of Prometheus (see
+ * MetricsServer).
+ *
+ * Metrics are organized in families, which share a name and a type and are distinguished by their labels. Looking up
+ * a metric locks the registry, but updating it does not, so frequently updated metrics should be looked up once:
+ *
+ *   static auto& scanned_rows = MetricsRegistry::get().counter("opossum_rows_scanned_total", "Rows scanned");
+ *   scanned_rows.increment(chunk.size());
+ *
+ * Metrics are never removed, so references to them stay valid. Values that are derived from the state of the engine,
+ * e.g., the memory usage of the tables, are computed by collectors when the metrics are exported instead. The
+ * components that own this state register the collectors (e.g., the StorageManager for the metrics of the tables).
+ */
+class MetricsRegistry : private Noncopyable {
+ public:
+  static MetricsRegistry& get();
+
+  Counter& counter(const std::string& name, const std::string& help, const MetricLabels& labels = {});
+  Gauge& gauge(const std::string& name, const std::string& help, const MetricLabels& labels = {});
+
+  // all histograms of a family have the bucket bounds with which the family was first requested
+  Histogram& histogram(const std::string& name, const std::string& help, const MetricLabels& labels = {},
+                       const std::vector<double>& bucket_bounds = DEFAULT_LATENCY_BUCKETS);
+
+  // adds a family of counters or gauges whose samples are computed by the collector whenever the metrics are exported
+  void add_collector(const std::string& name, const std::string& help, MetricType type,
+                     std::function<std::vector<MetricSample>()> collector);
+
+  // writes all metrics in the Prometheus text exposition format (version 0.0.4)
+  void write_prometheus_text(std::ostream& out) const;
+  std::string prometheus_text() const;
+
+  // sets all counters, gauges and histograms to zero, used especially in tests
+  void reset();
+
+  // bucket bounds in seconds from 10 us to 10 s
+  static const std::vector<double> DEFAULT_LATENCY_BUCKETS;
+
+  MetricsRegistry(MetricsRegistry&&) = delete;
+
+ protected:
+  MetricsRegistry();
+
+  struct Family {
+    std::string help;
+    MetricType type;
+    std::vector<double> bucket_bounds;
+    std::map<MetricLabels, std::unique_ptr<Counter>> counters;
+    std::map<MetricLabels, std::unique_ptr<Gauge>> gauges;
+    std::map<MetricLabels, std::unique_ptr<Histogram>> histograms;
+    std::function<std::vector<MetricSample>()> collector;
+  };
+
+  Family& _family(const std::string& name, const std::string& help, MetricType type);
+
+  // the families ordered by name, so that the export is deterministic
+  std::map<std::string, Family> _families;
+  mutable std::mutex _mutex;
+};
+
+}  // namespace opossum
@@ -0,0 +1,114 @@
+#include "metrics_server.hpp"
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/time.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <array>
+#include <cerrno>
+#include <chrono>
+#include <string>
+#include <thread>
+
+#include "utils/assert.hpp"
+#include "utils/metrics.hpp"
+
+namespace opossum {
+
+namespace {
+
+// requests are only read up to this size, larger ones are not expected from a scraper
+constexpr auto MAX_REQUEST_SIZE = size_t{8 * 1024};
+
+// accept is retried after this delay if it fails, e.g., because the process has run out of file descriptors
+constexpr auto ACCEPT_RETRY_DELAY = std::chrono::milliseconds{100};
+
+std::string response(const std::string& status, const std::string& content_type, const std::string& body) {
+  return "HTTP/1.1 " + status + "\r\nContent-Type: " + content_type +
+         "\r\nContent-Length: " + std::to_string(body.size()) + "\r\nConnection: close\r\n\r\n" + body;
+}
+
+void send_all(const int socket, const std::string& data) {
+  auto offset = size_t{0};
+  while (offset < data.size()) {
+    const auto sent_bytes = send(socket, data.data() + offset, data.size() - offset, MSG_NOSIGNAL);
+    if (sent_bytes <= 0) return;
+    offset += static_cast<size_t>(sent_bytes);
+  }
+}
+
+}  // namespace
+
+MetricsServer::MetricsServer(const uint16_t port) {
+  _socket = socket(AF_INET, SOCK_STREAM, 0);
+  Assert(_socket >= 0, "MetricsServer: Could not create socket");
+  const auto reuse_address = 1;
+  setsockopt(_socket, SOL_SOCKET, SO_REUSEADDR, &reuse_address, sizeof(reuse_address));
+
+  auto address = sockaddr_in{};
+  address.sin_family = AF_INET;
+  address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  address.sin_port = htons(port);
+  auto address_length = socklen_t{sizeof(address)};
+  const auto bound = bind(_socket, reinterpret_cast<sockaddr*>(&address), address_length) == 0 &&
+                     listen(_socket, SOMAXCONN) == 0 &&
+                     getsockname(_socket, reinterpret_cast<sockaddr*>(&address), &address_length) == 0;
+  if (!bound) close(_socket);
+  Assert(bound, "MetricsServer: Could not listen on port " + std::to_string(port));
+  _port = ntohs(address.sin_port);
+
+  _thread = std::thread{[this]() { _serve(); }};
+}
+
+MetricsServer::~MetricsServer() {
+  _is_stopping = true;
+  // wakes up the thread that waits in accept
+  shutdown(_socket, SHUT_RDWR);
+  _thread.join();
+  close(_socket);
+}
+
+uint16_t MetricsServer::port() const { return _port; }
+
+std::string MetricsServer::handle_request(const std::string& request) {
+  const auto request_line = request.substr(0, request.find("\r\n"));
+  const auto method_end = request_line.find(' ');
+  const auto path_end = request_line.find(' ', method_end + 1);
+  if (method_end == std::string::npos || path_end == std::string::npos) {
+    return response("400 Bad Request", "text/plain", "Bad Request\n");
+  }
+
+  const auto method = request_line.substr(0, method_end);
+  const auto path = request_line.substr(method_end + 1, path_end - method_end - 1);
+  if (path != "/metrics") return response("404 Not Found", "text/plain", "Not Found\n");
+  if (method != "GET") return response("405 Method Not Allowed", "text/plain", "Method Not Allowed\n");
+  return response("200 OK", "text/plain; version=0.0.4", MetricsRegistry::get().prometheus_text());
+}
+
+void MetricsServer::_serve() {
+  while (!_is_stopping) {
+    const auto connection = accept(_socket, nullptr, nullptr);
+    if (connection < 0) {
+      // errors such as EMFILE persist for a while, retrying immediately would only keep the thread busy
+      if (errno != EINTR && errno != ECONNABORTED && !_is_stopping) std::this_thread::sleep_for(ACCEPT_RETRY_DELAY);
+      continue;
+    }
+    // a client that does not send its request must not block the server for long
+    const auto timeout = timeval{1, 0};
+    setsockopt(connection, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+
+    auto request = std::string{};
+    auto buffer = std::array<char, 1024>{};
+    while (request.find("\r\n\r\n") == std::string::npos && request.size() < MAX_REQUEST_SIZE) {
+      const auto received_bytes = recv(connection, buffer.data(), buffer.size(), 0);
+      if (received_bytes <= 0) break;
+      request.append(buffer.data(), static_cast<size_t>(received_bytes));
+    }
+    send_all(connection, handle_request(request));
+    close(connection);
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <thread>
+
+#include "types.hpp"
+
+namespace opossum {
+
+// A minimal HTTP server on the loopback interface that answers GET /metrics with the metrics of the MetricsRegistry in
+// the Prometheus text format, so that a scraper running on the same host can collect them. It serves one connection
+// at a time on a background thread, which runs from the construction to the destruction of the server.
+//
+// Only the loopback interface is used, because the metrics are not authenticated. Use a reverse proxy to expose them.
+class MetricsServer : private Noncopyable {
+ public:
+  // listens on the given port of 127.0.0.1, or on a free port chosen by the system if port is 0
+  explicit MetricsServer(uint16_t port = 0);
+  ~MetricsServer();
+
+  // returns the port that the server listens on
+  uint16_t port() const;
+
+  // returns the HTTP response for a request, e.g., "GET /metrics HTTP/1.1\r\n..."
+  static std::string handle_request(const std::string& request);
+
+ protected:
+  void _serve();
+
+  int _socket = -1;
+  uint16_t _port = 0;
+  std::atomic_bool _is_stopping{false};
+  std::thread _thread;
+};
+
+}  // namespace opossum
@@ -0,0 +1,144 @@
+#include "performance_warning.hpp"
+
+#include <execinfo.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdlib>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace opossum {
+
+namespace {
+
+std::atomic_bool printing_enabled{true};
+
+std::string escape_json(const std::string& text) {
+  auto escaped = std::string{};
+  for (const auto character : text) {
+    if (character == '"' || character == '\\') {
+      escaped += '\\';
+      escaped += character;
+    } else if (character == '\n') {
+      escaped += "\\n";
+    } else if (static_cast<unsigned char>(character) >= 0x20) {
+      escaped += character;
+    }
+  }
+  return escaped;
+}
+
+}  // namespace
+
+std::atomic<uint64_t> PerformanceWarningSite::_stack_sampling_interval{0};
+std::atomic<PerformanceWarningSite*> PerformanceWarningRegistry::_first_site{nullptr};
+
+PerformanceWarningSite::PerformanceWarningSite(const char* text, const char* file_name, const int line)
+    : _text(text), _file_name(file_name), _line(line) {
+  auto& first_site = PerformanceWarningRegistry::_first_site;
+  _next_site = first_site.load();
+  while (!first_site.compare_exchange_weak(_next_site, this)) {
+  }
+}
+
+uint64_t PerformanceWarningSite::_count() const {
+  auto count = uint64_t{0};
+  for (const auto& counter : _counters) {
+    count += counter.count.load(std::memory_order_relaxed);
+  }
+  return count;
+}
+
+std::string PerformanceWarningSite::_location() const { return std::string{_file_name} + ":" + std::to_string(_line); }
+
+void PerformanceWarningSite::_print() const {
+  if (!IS_DEBUG || !PerformanceWarningRegistry::is_printing_enabled() || Tracer::is_enabled()) return;
+  std::cout << "[PERF] " << _text << " at " << _location()
+            << "\n\tPerformance can be affected. This warning is only shown once." << std::endl;
+}
+
+void PerformanceWarningSite::_sample_stack() {
+  constexpr auto MAX_FRAME_COUNT = 32;
+  auto frames = std::array<void*, MAX_FRAME_COUNT>{};
+  const auto frame_count = backtrace(frames.data(), MAX_FRAME_COUNT);
+  const auto symbols = std::unique_ptr<char*, decltype(&std::free)>{backtrace_symbols(frames.data(), frame_count),
+                                                                     &std::free};
+  if (!symbols) return;
+
+  // the first frame is this function
+  auto stack_trace = std::string{};
+  for (auto frame_index = 1; frame_index < frame_count; ++frame_index) {
+    stack_trace += symbols.get()[frame_index];
+    stack_trace += '\n';
+  }
+
+  std::lock_guard lock(_stack_samples_mutex);
+  if (_stack_samples.size() < PerformanceWarningRegistry::MAX_STACK_SAMPLES) _stack_samples.push_back(stack_trace);
+}
+
+std::vector<PerformanceWarningStatistics> PerformanceWarningRegistry::statistics() {
+  auto statistics = std::vector<PerformanceWarningStatistics>{};
+  for (auto site = _first_site.load(); site; site = site->_next_site) {
+    std::lock_guard lock(site->_stack_samples_mutex);
+    // every instantiation of a template has its own site, which are merged
+    auto existing_site = std::find_if(statistics.begin(), statistics.end(), [&](const auto& site_statistics) {
+      return site_statistics.line == site->_line && site_statistics.file_name == site->_file_name &&
+             site_statistics.text == site->_text;
+    });
+    if (existing_site == statistics.end()) {
+      statistics.push_back(PerformanceWarningStatistics{site->_text, site->_file_name, site->_line, 0, {}});
+      existing_site = std::prev(statistics.end());
+    }
+    existing_site->count += site->_count();
+    for (const auto& stack_sample : site->_stack_samples) {
+      if (existing_site->stack_samples.size() < MAX_STACK_SAMPLES) existing_site->stack_samples.push_back(stack_sample);
+    }
+  }
+  return statistics;
+}
+
+uint64_t PerformanceWarningRegistry::count(const std::string& text) {
+  auto count = uint64_t{0};
+  for (auto site = _first_site.load(); site; site = site->_next_site) {
+    if (site->_text == text) count += site->_count();
+  }
+  return count;
+}
+
+void PerformanceWarningRegistry::reset() {
+  for (auto site = _first_site.load(); site; site = site->_next_site) {
+    for (auto& counter : site->_counters) {
+      counter.count = 0;
+    }
+    std::lock_guard lock(site->_stack_samples_mutex);
+    site->_stack_samples.clear();
+  }
+}
+
+void PerformanceWarningRegistry::set_stack_sampling_interval(const uint64_t interval) {
+  PerformanceWarningSite::_stack_sampling_interval = interval;
+}
+
+void PerformanceWarningRegistry::set_printing_enabled(const bool enabled) { printing_enabled = enabled; }
+
+bool PerformanceWarningRegistry::is_printing_enabled() { return printing_enabled; }
+
+void PerformanceWarningRegistry::write_json(std::ostream& out) {
+  out << "[";
+  auto separator = "\n";
+  for (const auto& site : statistics()) {
+    out << separator << "  {\"text\": \"" << escape_json(site.text) << "\", \"file\": \"" << escape_json(site.file_name)
+        << "\", \"line\": " << site.line << ", \"count\": " << site.count << ", \"stack_samples\": [";
+    for (auto sample_index = size_t{0}; sample_index < site.stack_samples.size(); ++sample_index) {
+      out << (sample_index == 0 ? "" : ", ") << "\"" << escape_json(site.stack_samples[sample_index]) << "\"";
+    }
+    out << "]}";
+    separator = ",\n";
+  }
+  out << "\n]\n";
+}
+
+}  // namespace opossum
@@ -1,16 +1,33 @@
 #pragma once
 
-#include <boost/preprocessor/stringize.hpp>
+#include <array>
+#include <atomic>
+#include <cstdint>
 #include <iostream>
+#include <mutex>
 #include <string>
+#include <vector>
+
+#include "types.hpp"
+#include "utils/tracing.hpp"
 
 /**
  * Performance Warnings can be used in places where slow workarounds are used. This includes BaseSegment[] or the
  * use of a cross join followed by a projection instead of an equijoin.
  *
- * The warnings are printed only once per program execution. This is achieved by using static variables.
+ * Every call site of PerformanceWarning counts how often it is reached, also in release builds, so that slow fallback
+ * paths can be found under real load. The counters are updated without locks and can be queried and dumped as JSON
+ * with the PerformanceWarningRegistry. Each site has several counters, which the threads are spread across, so that
+ * warnings that many threads reach at once do not contend for a single cache line. Optionally, the registry samples
+ * the stack traces of every n-th occurrence of a warning (counted per counter), which tell where the slow path is used
+ * from.
+ *
+ * In debug builds, the warnings are also printed the first time they occur. While the Tracer is enabled, every
+ * occurrence is recorded as an instant event in the trace instead, so that it shows up next to the operator that
+ * caused it.
  *
- * Performance warnings can be disabled using the RAII-style PerformanceWarningDisabler:
+ * Intended uses of slow paths are excluded with the RAII-style PerformanceWarningDisabler, which neither counts nor
+ * prints the warnings of the current thread:
  *
  * {
  *   PerformanceWarningDisabler pwd;
@@ -21,52 +38,130 @@
  * Warnings do not print in tests.
  */
 
-class PerformanceWarningDisabler;
+namespace opossum {
 
-class PerformanceWarningClass {
-  static bool& disabled() {
-    // hacky hack that allows us to have state in a header file
-    static bool _disabled{false};
-    return _disabled;
-  }
+// the state of a call site of PerformanceWarning, see PerformanceWarningRegistry::statistics
+struct PerformanceWarningStatistics {
+  std::string text;
+  std::string file_name;
+  int line;
+  uint64_t count;
+  std::vector<std::string> stack_samples;
+};
 
+// A call site of PerformanceWarning. Sites are static objects, which register themselves when they are first reached.
+class PerformanceWarningSite : private Noncopyable {
  public:
-  explicit PerformanceWarningClass(const std::string& text) {
-    if (PerformanceWarningClass::disabled()) return;
-    std::cout << "[PERF] " << text << "\n\tPerformance can be affected. This warning is only shown once." << std::endl;
+  PerformanceWarningSite(const char* text, const char* file_name, int line);
+
+  // counts an occurrence of the warning, unless warnings are disabled for the current thread
+  void record() {
+    if (is_disabled()) return;
+    const auto count = _counters[_counter_index()].count.fetch_add(1, std::memory_order_relaxed) + 1;
+    // the flag is read before it is set, so that it is only written once
+    if (!_is_printed.load(std::memory_order_relaxed) && !_is_printed.exchange(true)) _print();
+    const auto sampling_interval = _stack_sampling_interval.load(std::memory_order_relaxed);
+    if (sampling_interval > 0 && count % sampling_interval == 0) _sample_stack();
+    TRACE_INSTANT("performance_warning", _text, _location());
+  }
+
+  static bool& is_disabled() {
+    // hacky hack that allows us to have state in a header file
+    static thread_local bool disabled{false};
+    return disabled;
   }
 
  protected:
-  static bool disable() {
-    bool previous = PerformanceWarningClass::disabled();
-    PerformanceWarningClass::disabled() = true;
-    return previous;
+  friend class PerformanceWarningRegistry;
+
+  static constexpr size_t COUNTER_COUNT = 16;
+
+  // each counter has its own cache line
+  struct alignas(64) Counter {
+    std::atomic<uint64_t> count{0};
+  };
+
+  // the counter of the current thread, the threads are assigned to the counters in a round-robin fashion
+  static size_t _counter_index() {
+    static std::atomic<size_t> next_counter_index{0};
+    static thread_local const auto counter_index =
+        next_counter_index.fetch_add(1, std::memory_order_relaxed) % COUNTER_COUNT;
+    return counter_index;
   }
 
-  static void enable() { PerformanceWarningClass::disabled() = false; }
+  // the sum of all counters
+  uint64_t _count() const;
+
+  std::string _location() const;
+  void _print() const;
+  void _sample_stack();
+
+  static std::atomic<uint64_t> _stack_sampling_interval;
+
+  const char* const _text;
+  const char* const _file_name;
+  const int _line;
+  std::array<Counter, COUNTER_COUNT> _counters;
+
+  // the warning is printed only once, even if the counters are reset
+  std::atomic<bool> _is_printed{false};
 
-  friend class PerformanceWarningDisabler;
+  // the sites form a list, to which new sites are prepended without locking
+  PerformanceWarningSite* _next_site = nullptr;
+
+  std::mutex _stack_samples_mutex;
+  std::vector<std::string> _stack_samples;
 };
 
+// Provides access to the counters of all call sites of PerformanceWarning that have been reached so far.
+class PerformanceWarningRegistry {
+ public:
+  // the number of stack traces that are kept per call site
+  static constexpr size_t MAX_STACK_SAMPLES = 8;
+
+  // returns the call sites in the reverse order of their first occurrence
+  static std::vector<PerformanceWarningStatistics> statistics();
+
+  // returns how often the warnings with the given text have occurred
+  static uint64_t count(const std::string& text);
+
+  // sets the counters to zero and discards the stack samples, warnings that have already been printed are not printed
+  // again
+  static void reset();
+
+  // samples the stack trace of every n-th occurrence of a warning, or none if interval is zero (the default)
+  static void set_stack_sampling_interval(uint64_t interval);
+
+  // enables or disables printing the first occurrence of a warning in debug builds
+  static void set_printing_enabled(bool enabled);
+  static bool is_printing_enabled();
+
+  // writes the statistics as a JSON array
+  static void write_json(std::ostream& out);
+
+ protected:
+  friend class PerformanceWarningSite;
+
+  static std::atomic<PerformanceWarningSite*> _first_site;
+};
+
+}  // namespace opossum
+
 class PerformanceWarningDisabler {
   bool _previously_disabled;
 
  public:
-  PerformanceWarningDisabler() : _previously_disabled(PerformanceWarningClass::disable()) {}
-  ~PerformanceWarningDisabler() {
-    if (!_previously_disabled) PerformanceWarningClass::enable();
+  PerformanceWarningDisabler() : _previously_disabled(opossum::PerformanceWarningSite::is_disabled()) {
+    opossum::PerformanceWarningSite::is_disabled() = true;
   }
+  ~PerformanceWarningDisabler() { opossum::PerformanceWarningSite::is_disabled() = _previously_disabled; }
 };
 
-#if IS_DEBUG
 #ifndef __FILENAME__
 #define __FILENAME__ (__FILE__ + SOURCE_PATH_SIZE)
 #endif
-#define PerformanceWarning(text)                                                                 \
-  {                                                                                              \
-    static PerformanceWarningClass warn(std::string(text) + " at " + std::string(__FILENAME__) + \
-                                        ":" BOOST_PP_STRINGIZE(__LINE__));                       \
+#define PerformanceWarning(text)                                                                   \
+  {                                                                                                \
+    static opossum::PerformanceWarningSite performance_warning_site(text, __FILENAME__, __LINE__); \
+    performance_warning_site.record();                                                             \
   }  // NOLINT
-#else
-#define PerformanceWarning(text)
-#endif
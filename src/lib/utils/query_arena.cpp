@@ -0,0 +1,60 @@
+#include "query_arena.hpp"
+
+#include <memory_resource>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// the memory resource of the innermost arena of the thread, nullptr if there is none
+thread_local std::pmr::memory_resource* current_arena_memory_resource = nullptr;
+
+thread_local size_t allocated_bytes_of_thread = 0;
+
+}  // namespace
+
+CountingMemoryResource::CountingMemoryResource(std::pmr::memory_resource* upstream) : _upstream(upstream) {}
+
+void* CountingMemoryResource::do_allocate(const size_t bytes, const size_t alignment) {
+  allocated_bytes_of_thread += bytes;
+  return _upstream->allocate(bytes, alignment);
+}
+
+void CountingMemoryResource::do_deallocate(void* pointer, const size_t bytes, const size_t alignment) {
+  _upstream->deallocate(pointer, bytes, alignment);
+}
+
+bool CountingMemoryResource::do_is_equal(const std::pmr::memory_resource& other) const noexcept {
+  return this == &other || _upstream->is_equal(other);
+}
+
+QueryArena::QueryArena(const size_t initial_size)
+    : _memory_resource(initial_size),
+      _counting_memory_resource(&_memory_resource),
+      _previous_memory_resource(current_arena_memory_resource) {
+  current_arena_memory_resource = &_counting_memory_resource;
+}
+
+QueryArena::~QueryArena() {
+  DebugAssert(current_arena_memory_resource == &_counting_memory_resource,
+              "query arenas have to be destroyed in the reverse order of their creation");
+  current_arena_memory_resource = _previous_memory_resource;
+}
+
+std::pmr::memory_resource* QueryArena::memory_resource() { return &_counting_memory_resource; }
+
+std::pmr::memory_resource* QueryArena::current_memory_resource() {
+  if (current_arena_memory_resource) return current_arena_memory_resource;
+  // the default resource is wrapped once and never destroyed, because memory allocated through it can outlive any
+  // other object
+  static auto* const default_memory_resource = new CountingMemoryResource(std::pmr::get_default_resource());
+  return default_memory_resource;
+}
+
+bool QueryArena::is_active() { return current_arena_memory_resource != nullptr; }
+
+size_t QueryArena::allocated_bytes() { return allocated_bytes_of_thread; }
+
+}  // namespace opossum
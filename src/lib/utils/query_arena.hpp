@@ -0,0 +1,59 @@
+#pragma once
+
+#include <memory_resource>
+
+#include "types.hpp"
+
+namespace opossum {
+
+// Forwards all allocations to an upstream memory resource and adds their sizes to the allocation counter of the
+// calling thread (see QueryArena::allocated_bytes). Memory may be deallocated through the upstream resource directly.
+class CountingMemoryResource : public std::pmr::memory_resource {
+ public:
+  explicit CountingMemoryResource(std::pmr::memory_resource* upstream);
+
+ protected:
+  void* do_allocate(size_t bytes, size_t alignment) override;
+  void do_deallocate(void* pointer, size_t bytes, size_t alignment) override;
+  bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+  std::pmr::memory_resource* const _upstream;
+};
+
+// A QueryArena provides a monotonic memory resource for the intermediate results of all operators that are executed on
+// the same thread while the arena exists, e.g., the position lists of table scans. Allocations are served from large
+// blocks and are not freed individually; instead, all memory is released at once when the arena is destroyed. This
+// avoids contention in the global allocator and page faults for freshly allocated memory.
+//
+// As a consequence, no intermediate result may be used after the arena has been destroyed. In particular, output
+// tables of operators that were executed within the arena must not be added to the StorageManager or kept in a
+// ResultCache, which therefore does not cache results while an arena is active.
+//
+// Arenas can be nested, the innermost arena is used. They must be destroyed in the reverse order of their creation,
+// which is guaranteed if they are only created on the stack.
+class QueryArena : private Noncopyable {
+ public:
+  // the first block of the arena has the given size, further blocks grow geometrically
+  explicit QueryArena(const size_t initial_size = 1024 * 1024);
+  ~QueryArena();
+
+  std::pmr::memory_resource* memory_resource();
+
+  // returns the memory resource of the innermost arena of the calling thread, or the default memory resource if there
+  // is no arena
+  static std::pmr::memory_resource* current_memory_resource();
+
+  // returns whether the calling thread allocates intermediate results from an arena
+  static bool is_active();
+
+  // returns the number of bytes that the calling thread has allocated from the memory resources returned by
+  // current_memory_resource so far, including memory that has been freed again
+  static size_t allocated_bytes();
+
+ protected:
+  std::pmr::monotonic_buffer_resource _memory_resource;
+  CountingMemoryResource _counting_memory_resource;
+  std::pmr::memory_resource* const _previous_memory_resource;
+};
+
+}  // namespace opossum
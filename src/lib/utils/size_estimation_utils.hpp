@@ -0,0 +1,36 @@
+#pragma once
+
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace opossum {
+
+/**
+ * Helpers for the estimate_memory_usage() methods of segments, chunks and tables. The estimations count the memory
+ * that is allocated by the containers (i.e., their capacity, not their size), but ignore allocator overhead.
+ */
+
+// returns the number of bytes a string has allocated on the heap, which is zero if the small string optimization
+// (SSO) keeps the string within the std::string object itself
+inline size_t string_heap_size(const std::string& string) {
+  static const auto sso_capacity = std::string{}.capacity();
+  if (string.capacity() <= sso_capacity) return 0;
+  // one additional byte is allocated for the terminating null character
+  return string.capacity() + 1;
+}
+
+// returns the number of bytes allocated by the vector, excluding the vector object itself
+// for strings, the heap allocations of the individual strings are included as well
+template <typename T, typename Allocator>
+size_t vector_heap_size(const std::vector<T, Allocator>& values) {
+  auto bytes = values.capacity() * sizeof(T);
+  if constexpr (std::is_same_v<T, std::string>) {
+    for (const auto& value : values) {
+      bytes += string_heap_size(value);
+    }
+  }
+  return bytes;
+}
+
+}  // namespace opossum
@@ -0,0 +1,210 @@
+#include "tracing.hpp"
+
+#include <atomic>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+struct TraceEvent {
+  const char* category;
+  std::string name;
+  std::string detail;
+  // 'X' for spans and 'i' for instant events, as in the trace event format
+  char phase;
+  std::chrono::steady_clock::time_point start;
+  std::chrono::steady_clock::duration duration;
+};
+
+// The events of one thread. Only the thread itself records into it, the mutex merely guards against concurrent reads
+// of the trace and is therefore hardly ever contended.
+struct ThreadBuffer {
+  std::mutex mutex;
+  size_t thread_index = 0;
+  std::string thread_name;
+  size_t capacity = 0;
+  std::vector<TraceEvent> events;
+  // the position at which the next event is stored once the buffer is full
+  size_t next_index = 0;
+
+  void record(TraceEvent&& event) {
+    std::lock_guard lock(mutex);
+    if (events.size() < capacity) {
+      events.push_back(std::move(event));
+      return;
+    }
+    if (capacity == 0) return;
+    events[next_index] = std::move(event);
+    next_index = (next_index + 1) % capacity;
+  }
+};
+
+std::atomic_bool tracing_enabled{false};
+std::atomic<size_t> buffer_capacity{Tracer::DEFAULT_BUFFER_CAPACITY};
+
+// the timestamps of the trace are relative to the start of the program
+const auto trace_epoch = std::chrono::steady_clock::now();
+
+// Buffers stay registered after their thread exits, so that the events of short-lived worker threads are kept.
+std::mutex registry_mutex;
+std::vector<std::shared_ptr<ThreadBuffer>> registered_buffers;
+size_t next_thread_index = 0;
+
+thread_local std::string current_thread_name;
+thread_local std::shared_ptr<ThreadBuffer> current_buffer;
+
+ThreadBuffer& thread_buffer() {
+  if (!current_buffer) {
+    current_buffer = std::make_shared<ThreadBuffer>();
+    current_buffer->capacity = buffer_capacity;
+    current_buffer->thread_name = current_thread_name;
+
+    std::lock_guard lock(registry_mutex);
+    current_buffer->thread_index = next_thread_index++;
+    registered_buffers.push_back(current_buffer);
+  }
+  return *current_buffer;
+}
+
+std::string escape_json(const std::string& text) {
+  auto escaped = std::string{};
+  escaped.reserve(text.size());
+  for (const auto character : text) {
+    switch (character) {
+      case '"':
+        escaped += "\\\"";
+        break;
+      case '\\':
+        escaped += "\\\\";
+        break;
+      case '\n':
+        escaped += "\\n";
+        break;
+      case '\t':
+        escaped += "\\t";
+        break;
+      default:
+        if (static_cast<unsigned char>(character) < 0x20) continue;
+        escaped += character;
+    }
+  }
+  return escaped;
+}
+
+double to_microseconds(const std::chrono::steady_clock::duration duration) {
+  return std::chrono::duration<double, std::micro>{duration}.count();
+}
+
+}  // namespace
+
+void Tracer::set_enabled(const bool enabled) { tracing_enabled = enabled; }
+
+bool Tracer::is_enabled() { return tracing_enabled.load(std::memory_order_relaxed); }
+
+void Tracer::set_buffer_capacity(const size_t capacity) { buffer_capacity = capacity; }
+
+void Tracer::set_thread_name(const std::string& name) {
+  current_thread_name = name;
+  if (current_buffer) {
+    std::lock_guard lock(current_buffer->mutex);
+    current_buffer->thread_name = name;
+  }
+}
+
+void Tracer::clear() {
+  std::lock_guard registry_lock(registry_mutex);
+  for (const auto& buffer : registered_buffers) {
+    std::lock_guard lock(buffer->mutex);
+    buffer->events.clear();
+    buffer->next_index = 0;
+    buffer->capacity = buffer_capacity;
+  }
+  // buffers of threads that have exited are no longer needed
+  auto remaining_buffers = std::vector<std::shared_ptr<ThreadBuffer>>{};
+  for (auto& buffer : registered_buffers) {
+    if (buffer.use_count() > 1) remaining_buffers.push_back(std::move(buffer));
+  }
+  registered_buffers = std::move(remaining_buffers);
+}
+
+size_t Tracer::event_count() {
+  std::lock_guard registry_lock(registry_mutex);
+  auto count = size_t{0};
+  for (const auto& buffer : registered_buffers) {
+    std::lock_guard lock(buffer->mutex);
+    count += buffer->events.size();
+  }
+  return count;
+}
+
+void Tracer::write_chrome_trace(std::ostream& out) {
+  std::lock_guard registry_lock(registry_mutex);
+  out << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+  auto separator = "\n";
+  for (const auto& buffer : registered_buffers) {
+    std::lock_guard lock(buffer->mutex);
+    if (buffer->events.empty()) continue;
+
+    const auto thread_name =
+        buffer->thread_name.empty() ? "thread " + std::to_string(buffer->thread_index) : buffer->thread_name;
+    out << separator << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":" << buffer->thread_index
+        << ",\"args\":{\"name\":\"" << escape_json(thread_name) << "\"}}";
+    separator = ",\n";
+
+    // once the buffer is full, the oldest event is the one that is overwritten next
+    for (auto offset = size_t{0}; offset < buffer->events.size(); ++offset) {
+      const auto& event = buffer->events[(buffer->next_index + offset) % buffer->events.size()];
+      out << separator << "{\"name\":\"" << escape_json(event.name) << "\",\"cat\":\"" << event.category
+          << "\",\"ph\":\"" << event.phase << "\",\"ts\":" << to_microseconds(event.start - trace_epoch);
+      if (event.phase == 'X') {
+        out << ",\"dur\":" << to_microseconds(event.duration);
+      } else {
+        // instant events are only shown on the timeline of their thread
+        out << ",\"s\":\"t\"";
+      }
+      out << ",\"pid\":0,\"tid\":" << buffer->thread_index;
+      if (!event.detail.empty()) out << ",\"args\":{\"detail\":\"" << escape_json(event.detail) << "\"}";
+      out << "}";
+    }
+  }
+  out << "\n]}\n";
+}
+
+void Tracer::write_chrome_trace(const std::string& file_name) {
+  auto file = std::ofstream{file_name};
+  Assert(file.is_open(), "could not open " + file_name);
+  write_chrome_trace(file);
+}
+
+void Tracer::record_span(const char* category, const std::string& name,
+                         const std::chrono::steady_clock::time_point start, const std::string& detail) {
+  const auto end = std::chrono::steady_clock::now();
+  thread_buffer().record(TraceEvent{category, name, detail, 'X', start, end - start});
+}
+
+void Tracer::record_instant(const char* category, const std::string& name, const std::string& detail) {
+  thread_buffer().record(TraceEvent{category, name, detail, 'i', std::chrono::steady_clock::now(), {}});
+}
+
+TraceSpan::TraceSpan(const char* category) : _category(category), _is_active(Tracer::is_enabled()) {
+  if (_is_active) _start = std::chrono::steady_clock::now();
+}
+
+TraceSpan::~TraceSpan() {
+  if (_is_active) Tracer::record_span(_category, _name, _start, _detail);
+}
+
+void TraceSpan::set_name(std::string name, std::string detail) {
+  _name = std::move(name);
+  _detail = std::move(detail);
+}
+
+}  // namespace opossum
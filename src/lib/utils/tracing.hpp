@@ -0,0 +1,91 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <string>
+
+#include <boost/preprocessor/cat.hpp>
+
+namespace opossum {
+
+/**
+ * Records a timeline of what each thread does, e.g., which operators and chunk jobs run when and where, and writes it
+ * in the trace event format of Chrome, which can be viewed in about:tracing or with Perfetto (ui.perfetto.dev).
+ *
+ * Code is instrumented with spans, which cover a scope, and instant events, which mark a point in time:
+ *
+ *   TRACE_SPAN("operator", op.description());
+ *   TRACE_INSTANT("performance_warning", "operator[] used");
+ *
+ * Recording is disabled by default. While it is disabled, a span costs a single atomic load and its name is not even
+ * evaluated. Every thread records into its own ring buffer, so that threads do not contend; once a buffer is full, its
+ * oldest events are overwritten. Building with -DENABLE_TRACING=OFF removes all spans and instant events at compile
+ * time.
+ */
+class Tracer {
+ public:
+  // number of events that every thread keeps
+  static constexpr size_t DEFAULT_BUFFER_CAPACITY = 64 * 1024;
+
+  static void set_enabled(bool enabled);
+  static bool is_enabled();
+
+  // takes effect for buffers created or cleared afterwards
+  static void set_buffer_capacity(size_t capacity);
+
+  // names the calling thread in the trace, e.g., "worker 3 (node 0)"
+  static void set_thread_name(const std::string& name);
+
+  // discards all recorded events
+  static void clear();
+
+  // returns the number of events that are currently kept in all buffers
+  static size_t event_count();
+
+  // writes all kept events as a JSON trace
+  static void write_chrome_trace(std::ostream& out);
+  static void write_chrome_trace(const std::string& file_name);
+
+  // records a span of the calling thread that began at start and ends now
+  static void record_span(const char* category, const std::string& name, std::chrono::steady_clock::time_point start,
+                          const std::string& detail = "");
+  static void record_instant(const char* category, const std::string& name, const std::string& detail = "");
+};
+
+// Records a span from its construction to its destruction, if the Tracer was enabled at construction. The name is set
+// separately, so that it is only built for active spans (see TRACE_SPAN).
+class TraceSpan {
+ public:
+  explicit TraceSpan(const char* category);
+  ~TraceSpan();
+
+  TraceSpan(const TraceSpan&) = delete;
+  TraceSpan& operator=(const TraceSpan&) = delete;
+
+  bool is_active() const { return _is_active; }
+  void set_name(std::string name, std::string detail = "");
+
+ protected:
+  const char* const _category;
+  const bool _is_active;
+  std::string _name;
+  std::string _detail;
+  std::chrono::steady_clock::time_point _start;
+};
+
+}  // namespace opossum
+
+#if HYRISE_TRACING
+// the name and the optional detail are only evaluated if the Tracer is enabled
+#define TRACE_SPAN(category, ...)                                  \
+  opossum::TraceSpan BOOST_PP_CAT(trace_span_, __LINE__){category}; \
+  if (BOOST_PP_CAT(trace_span_, __LINE__).is_active()) BOOST_PP_CAT(trace_span_, __LINE__).set_name(__VA_ARGS__)
+#define TRACE_INSTANT(category, ...)                        \
+  if (opossum::Tracer::is_enabled()) {                      \
+    opossum::Tracer::record_instant(category, __VA_ARGS__); \
+  }  // NOLINT
+#else
+#define TRACE_SPAN(category, ...)
+#define TRACE_INSTANT(category, ...)
+#endif
@@ -4,7 +4,7 @@
 #include "utils/performance_warning.hpp"
 
 int main(int argc, char** argv) {
-  PerformanceWarningDisabler pwd;
+  opossum::PerformanceWarningRegistry::set_printing_enabled(false);
   ::testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
 }
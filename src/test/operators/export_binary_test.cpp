@@ -0,0 +1,92 @@
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <string>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/export_binary.hpp"
+#include "operators/import_binary.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/table.hpp"
+#include "utils/load_table.hpp"
+
+namespace opossum {
+
+class OperatorsExportBinaryTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = std::make_shared<Table>(3);
+    _table->add_column("a", "int");
+    _table->add_column("b", "long");
+    _table->add_column("c", "float");
+    _table->add_column("d", "double");
+    _table->add_column("e", "string");
+    for (auto value = 0; value < 8; ++value) {
+      _table->append({value, int64_t{value} * 1000000000, value * 0.5f, value * 0.25, std::string(value * 10, 'x')});
+    }
+  }
+
+  void TearDown() override { std::remove(_file_name.c_str()); }
+
+  const std::string _file_name = "export_binary_test.bin";
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(OperatorsExportBinaryTest, ValueSegments) {
+  auto table_wrapper = std::make_shared<TableWrapper>(_table);
+  table_wrapper->execute();
+  auto export_binary = std::make_shared<ExportBinary>(table_wrapper, _file_name);
+  export_binary->execute();
+
+  EXPECT_EQ(export_binary->get_output(), _table);
+  EXPECT_TRUE(std::ifstream(_file_name).good());
+
+  const auto imported_table = ImportBinary::read_table(_file_name);
+  EXPECT_TABLE_EQ(imported_table, _table, true);
+  EXPECT_EQ(imported_table->chunk_count(), _table->chunk_count());
+  EXPECT_EQ(imported_table->chunk_size(), _table->chunk_size());
+}
+
+TEST_F(OperatorsExportBinaryTest, DictionarySegments) {
+  _table->compress_chunk(ChunkID{0});
+  _table->compress_chunk(ChunkID{2});
+  ExportBinary::write_table(*_table, _file_name);
+
+  const auto imported_table = ImportBinary::read_table(_file_name);
+  EXPECT_TABLE_EQ(imported_table, _table, true);
+
+  // the encoding of every chunk is preserved
+  const auto segment = imported_table->get_chunk(ChunkID{0}).get_segment(ColumnID{4});
+  EXPECT_NE(std::dynamic_pointer_cast<DictionarySegment<std::string>>(segment), nullptr);
+  const auto unencoded_segment = imported_table->get_chunk(ChunkID{1}).get_segment(ColumnID{0});
+  EXPECT_NE(std::dynamic_pointer_cast<ValueSegment<int>>(unencoded_segment), nullptr);
+}
+
+TEST_F(OperatorsExportBinaryTest, ReferenceSegments) {
+  _table->compress_chunk(ChunkID{1});
+  auto table_wrapper = std::make_shared<TableWrapper>(_table);
+  table_wrapper->execute();
+  auto table_scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpGreaterThanEquals, 2);
+  table_scan->execute();
+  auto export_binary = std::make_shared<ExportBinary>(table_scan, _file_name);
+  export_binary->execute();
+
+  const auto imported_table = ImportBinary::read_table(_file_name);
+  EXPECT_TABLE_EQ(imported_table, table_scan->get_output(), true);
+}
+
+TEST_F(OperatorsExportBinaryTest, EmptyTable) {
+  auto table = std::make_shared<Table>();
+  table->add_column("a", "int");
+  ExportBinary::write_table(*table, _file_name);
+
+  const auto imported_table = ImportBinary::read_table(_file_name);
+  EXPECT_EQ(imported_table->row_count(), 0u);
+  EXPECT_EQ(imported_table->column_name(ColumnID{0}), "a");
+}
+
+}  // namespace opossum
@@ -0,0 +1,108 @@
+#include <unistd.h>
+
+#include <array>
+#include <cstdio>
+#include <memory>
+#include <string>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/export.hpp"
+#include "operators/import_binary.hpp"
+#include "operators/import_csv.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/table.hpp"
+#include "utils/load_table.hpp"
+
+namespace opossum {
+
+class OperatorsExportTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _file = std::tmpfile();
+    _table_wrapper = std::make_shared<TableWrapper>(load_table("src/test/tables/int_float.tbl", 2));
+    _table_wrapper->execute();
+  }
+
+  void TearDown() override {
+    std::fclose(_file);
+    std::remove(_file_name.c_str());
+  }
+
+  // returns everything that has been written to the temporary file
+  std::string _file_content() {
+    std::rewind(_file);
+    auto content = std::string{};
+    auto buffer = std::array<char, 4096>{};
+    while (const auto read = std::fread(buffer.data(), 1, buffer.size(), _file)) {
+      content.append(buffer.data(), read);
+    }
+    return content;
+  }
+
+  // writes the content of the temporary file to a named file so that it can be imported
+  void _copy_to_named_file() {
+    auto* named_file = std::fopen(_file_name.c_str(), "wb");
+    const auto content = _file_content();
+    std::fwrite(content.data(), 1, content.size(), named_file);
+    std::fclose(named_file);
+  }
+
+  const std::string _file_name = "export_test.out";
+  std::FILE* _file = nullptr;
+  std::shared_ptr<TableWrapper> _table_wrapper;
+};
+
+TEST_F(OperatorsExportTest, Csv) {
+  auto export_operator = std::make_shared<Export>(_table_wrapper, fileno(_file));
+  export_operator->execute();
+
+  EXPECT_EQ(export_operator->get_output(), _table_wrapper->get_output());
+  EXPECT_EQ(_file_content(), "a|b\nint|float\n12345|458.7\n123|456.7\n1234|457.7\n");
+}
+
+TEST_F(OperatorsExportTest, CsvWithDelimiter) {
+  auto table = std::make_shared<Table>(2);
+  table->add_column("a", "long");
+  table->add_column("b", "double");
+  table->add_column("c", "string");
+  table->append({int64_t{10000000000}, 0.5, "x"});
+  table->append({int64_t{-1}, 1e100, "a b"});
+  table->append({int64_t{7}, -2.25, ""});
+  table->compress_chunk(ChunkID{0});
+
+  Export::write_table(*table, fileno(_file), ExportFormat::Csv, ',');
+  EXPECT_EQ(_file_content(), "a,b,c\nlong,double,string\n10000000000,0.5,x\n-1,1e+100,a b\n7,-2.25,\n");
+}
+
+TEST_F(OperatorsExportTest, CsvRoundTrip) {
+  auto table_scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThanEquals, 1234);
+  table_scan->execute();
+  auto export_operator = std::make_shared<Export>(table_scan, fileno(_file));
+  export_operator->execute();
+  _copy_to_named_file();
+
+  EXPECT_TABLE_EQ(ImportCsv::read_table(_file_name), table_scan->get_output(), true);
+}
+
+TEST_F(OperatorsExportTest, BinaryRoundTrip) {
+  auto table_scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpLessThan, 1234);
+  table_scan->execute();
+  auto export_operator = std::make_shared<Export>(table_scan, fileno(_file), ExportFormat::Binary);
+  export_operator->execute();
+  _copy_to_named_file();
+
+  EXPECT_TABLE_EQ(ImportBinary::read_table(_file_name), table_scan->get_output(), true);
+}
+
+TEST_F(OperatorsExportTest, StringsThatNeedQuoting) {
+  auto table = std::make_shared<Table>();
+  table->add_column("a", "string");
+  table->append({"a|b"});
+
+  EXPECT_THROW(Export::write_table(*table, fileno(_file)), std::exception);
+}
+
+}  // namespace opossum
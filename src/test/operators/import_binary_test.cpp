@@ -0,0 +1,63 @@
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <string>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/export_binary.hpp"
+#include "operators/import_binary.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "utils/load_table.hpp"
+
+namespace opossum {
+
+class OperatorsImportBinaryTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = load_table("src/test/tables/int_float.tbl", 2);
+    ExportBinary::write_table(*_table, _file_name);
+  }
+
+  void TearDown() override { std::remove(_file_name.c_str()); }
+
+  const std::string _file_name = "import_binary_test.bin";
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(OperatorsImportBinaryTest, ImportWithoutTableName) {
+  auto import_binary = std::make_shared<ImportBinary>(_file_name);
+  import_binary->execute();
+
+  EXPECT_TABLE_EQ(import_binary->get_output(), _table, true);
+  EXPECT_TRUE(StorageManager::get().table_names().empty());
+}
+
+TEST_F(OperatorsImportBinaryTest, ImportIntoStorageManager) {
+  auto import_binary = std::make_shared<ImportBinary>(_file_name, "int_float");
+  import_binary->execute();
+
+  EXPECT_EQ(StorageManager::get().get_table("int_float"), import_binary->get_output());
+
+  // a second import returns the table that is already registered
+  auto second_import_binary = std::make_shared<ImportBinary>(_file_name, "int_float");
+  second_import_binary->execute();
+  EXPECT_EQ(second_import_binary->get_output(), import_binary->get_output());
+}
+
+TEST_F(OperatorsImportBinaryTest, MissingFile) {
+  auto import_binary = std::make_shared<ImportBinary>("does_not_exist.bin");
+  EXPECT_THROW(import_binary->execute(), std::exception);
+}
+
+TEST_F(OperatorsImportBinaryTest, TruncatedFile) {
+  {
+    std::ofstream file(_file_name, std::ios::binary | std::ios::trunc);
+    file << "abc";
+  }
+  EXPECT_THROW(ImportBinary::read_table(_file_name), std::exception);
+}
+
+}  // namespace opossum
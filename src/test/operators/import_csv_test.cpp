@@ -0,0 +1,99 @@
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <string>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/import_csv.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "utils/load_table.hpp"
+
+namespace opossum {
+
+class OperatorsImportCsvTest : public BaseTest {
+ protected:
+  void TearDown() override { std::remove(_file_name.c_str()); }
+
+  const std::string _file_name = "import_csv_test.csv";
+};
+
+TEST_F(OperatorsImportCsvTest, ImportTbl) {
+  const auto expected_table = load_table("src/test/tables/int_float.tbl", 2);
+  auto import_csv = std::make_shared<ImportCsv>("src/test/tables/int_float.tbl", 2);
+  import_csv->execute();
+
+  EXPECT_TABLE_EQ(import_csv->get_output(), expected_table, true);
+  EXPECT_EQ(import_csv->get_output()->chunk_count(), expected_table->chunk_count());
+  EXPECT_EQ(import_csv->get_output()->get_chunk(ChunkID{0}).size(), 2u);
+}
+
+TEST_F(OperatorsImportCsvTest, ImportIntoStorageManager) {
+  auto import_csv = std::make_shared<ImportCsv>("src/test/tables/int_float.tbl", 2, "int_float");
+  import_csv->execute();
+
+  EXPECT_EQ(StorageManager::get().get_table("int_float"), import_csv->get_output());
+}
+
+TEST_F(OperatorsImportCsvTest, CompressChunks) {
+  const auto table = ImportCsv::read_table("src/test/tables/int_float.tbl", 2, true);
+  EXPECT_TABLE_EQ(table, load_table("src/test/tables/int_float.tbl", 2), true);
+
+  for (ChunkID chunk_id{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    const auto segment = table->get_chunk(chunk_id).get_segment(ColumnID{0});
+    EXPECT_NE(std::dynamic_pointer_cast<DictionarySegment<int>>(segment), nullptr);
+  }
+}
+
+TEST_F(OperatorsImportCsvTest, CommaSeparatedWithAllTypes) {
+  {
+    std::ofstream file(_file_name);
+    file << "a,b,c,d,e\r\nint,long,float,double,string\r\n";
+    for (auto row = 0; row < 1000; ++row) {
+      file << row << "," << int64_t{row} * 10000000000 << "," << row << ".5," << row << ".25,value" << row << "\r\n";
+    }
+    file << "\r\n";
+  }
+
+  const auto table = ImportCsv::read_table(_file_name, 100, false, ',');
+  EXPECT_EQ(table->row_count(), 1000u);
+  EXPECT_EQ(table->chunk_count(), 10u);
+  EXPECT_EQ(table->column_type(ColumnID{4}), "string");
+
+  const auto& chunk = table->get_chunk(ChunkID{9});
+  EXPECT_EQ(type_cast<int32_t>((*chunk.get_segment(ColumnID{0}))[99]), 999);
+  EXPECT_EQ(type_cast<int64_t>((*chunk.get_segment(ColumnID{1}))[99]), 9990000000000);
+  EXPECT_FLOAT_EQ(type_cast<float>((*chunk.get_segment(ColumnID{2}))[99]), 999.5f);
+  EXPECT_DOUBLE_EQ(type_cast<double>((*chunk.get_segment(ColumnID{3}))[99]), 999.25);
+  EXPECT_EQ(type_cast<std::string>((*chunk.get_segment(ColumnID{4}))[99]), "value999");
+}
+
+TEST_F(OperatorsImportCsvTest, EmptyTable) {
+  {
+    std::ofstream file(_file_name);
+    file << "a|b\nint|string\n";
+  }
+
+  const auto table = ImportCsv::read_table(_file_name);
+  EXPECT_EQ(table->row_count(), 0u);
+  EXPECT_EQ(table->column_count(), 2u);
+}
+
+TEST_F(OperatorsImportCsvTest, InvalidValues) {
+  {
+    std::ofstream file(_file_name);
+    file << "a|b\nint|float\n1|2.5\nthree|4.5\n";
+  }
+  EXPECT_THROW(ImportCsv::read_table(_file_name), std::exception);
+
+  {
+    std::ofstream file(_file_name);
+    file << "a|b\nint|float\n1|2.5\n3\n";
+  }
+  EXPECT_THROW(ImportCsv::read_table(_file_name), std::exception);
+}
+
+}  // namespace opossum
@@ -0,0 +1,91 @@
+#include <memory>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/operators/pipeline.hpp"
+#include "../lib/operators/table_scan.hpp"
+#include "../lib/operators/table_wrapper.hpp"
+#include "../lib/scheduler/topology.hpp"
+#include "../lib/storage/table.hpp"
+
+namespace opossum {
+
+class OperatorsPipelineTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    auto table = std::make_shared<Table>(10);
+    table->add_column("a", "int");
+    table->add_column("b", "string");
+    for (auto value = 0; value < 100; ++value) {
+      table->append({value, std::to_string(value % 7)});
+    }
+    for (ChunkID chunk_id{0}; chunk_id < 5; ++chunk_id) {
+      table->compress_chunk(chunk_id);
+    }
+    _table_wrapper = std::make_shared<TableWrapper>(table);
+    _table_wrapper->execute();
+  }
+
+  void TearDown() override { Topology::reset(); }
+
+  std::shared_ptr<TableWrapper> _table_wrapper;
+};
+
+TEST_F(OperatorsPipelineTest, MatchesOperatorAtATimeExecution) {
+  auto scan_1 = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThanEquals, 15);
+  auto scan_2 = std::make_shared<TableScan>(scan_1, ColumnID{1}, ScanType::OpNotEquals, "3");
+  auto scan_3 = std::make_shared<TableScan>(scan_2, ColumnID{0}, ScanType::OpLessThan, 82);
+
+  auto pipeline = Pipeline::create(scan_3);
+  EXPECT_EQ(pipeline->input_left(), _table_wrapper);
+  ASSERT_EQ(pipeline->operators().size(), 3u);
+  pipeline->execute();
+
+  // the operators of the pipeline were not executed themselves
+  EXPECT_EQ(scan_1->get_output(), nullptr);
+
+  scan_1->execute();
+  scan_2->execute();
+  scan_3->execute();
+  EXPECT_TABLE_EQ(pipeline->get_output(), scan_3->get_output(), true);
+  EXPECT_EQ(pipeline->get_output()->chunk_count(), 8u);
+}
+
+TEST_F(OperatorsPipelineTest, KeepsChunkOrderWithSeveralNodes) {
+  Topology::get().use_simulated_topology(3, 1);
+  auto scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpNotEquals, 42);
+  auto pipeline = Pipeline::create(scan);
+  pipeline->execute();
+
+  const auto output = pipeline->get_output();
+  ASSERT_EQ(output->row_count(), 99u);
+  auto expected_value = 0;
+  for (ChunkID chunk_id{0}; chunk_id < output->chunk_count(); ++chunk_id) {
+    const auto segment = output->get_chunk(chunk_id).get_segment(ColumnID{0});
+    for (ChunkOffset chunk_offset{0}; chunk_offset < segment->size(); ++chunk_offset, ++expected_value) {
+      if (expected_value == 42) ++expected_value;
+      EXPECT_EQ((*segment)[chunk_offset], AllTypeVariant{expected_value});
+    }
+  }
+}
+
+TEST_F(OperatorsPipelineTest, EmptyResult) {
+  auto scan_1 = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpLessThan, 10);
+  auto scan_2 = std::make_shared<TableScan>(scan_1, ColumnID{0}, ScanType::OpGreaterThan, 50);
+  auto pipeline = Pipeline::create(scan_2);
+  pipeline->execute();
+
+  EXPECT_EQ(pipeline->get_output()->row_count(), 0u);
+  EXPECT_EQ(pipeline->get_output()->column_count(), 2u);
+}
+
+TEST_F(OperatorsPipelineTest, RequiresChainedOperators) {
+  auto scan_1 = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpLessThan, 10);
+  auto scan_2 = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThan, 5);
+  EXPECT_THROW(Pipeline(_table_wrapper, {scan_1, scan_2}), std::exception);
+  EXPECT_THROW(Pipeline(_table_wrapper, {}), std::exception);
+}
+
+}  // namespace opossum
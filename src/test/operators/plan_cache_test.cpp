@@ -0,0 +1,126 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/operators/get_table.hpp"
+#include "../lib/operators/pipeline.hpp"
+#include "../lib/operators/plan_cache.hpp"
+#include "../lib/operators/table_scan.hpp"
+#include "../lib/storage/storage_manager.hpp"
+#include "../lib/storage/table.hpp"
+
+namespace opossum {
+
+class OperatorsPlanCacheTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    auto table = std::make_shared<Table>(10);
+    table->add_column("a", "int");
+    table->add_column("b", "string");
+    for (auto value = 0; value < 100; ++value) {
+      table->append({value, std::to_string(value % 7)});
+    }
+    table->compress_chunk(ChunkID{0});
+    StorageManager::get().add_table("table_a", table);
+  }
+
+  void TearDown() override { StorageManager::reset(); }
+
+  // a plan with the parameters a >= first and b != second
+  static std::shared_ptr<AbstractOperator> create_plan(const int first, const std::string& second,
+                                                       const bool pipelined) {
+    const auto get_table = std::make_shared<GetTable>("table_a");
+    const auto scan_1 = std::make_shared<TableScan>(get_table, ColumnID{0}, ScanType::OpGreaterThanEquals, first);
+    const auto scan_2 = std::make_shared<TableScan>(scan_1, ColumnID{1}, ScanType::OpNotEquals, second);
+    if (pipelined) return Pipeline::create(scan_2);
+    return scan_2;
+  }
+
+  static uint64_t execute(const std::vector<std::shared_ptr<AbstractOperator>>& operators) {
+    for (const auto& op : operators) op->execute();
+    return operators.back()->get_output()->row_count();
+  }
+};
+
+TEST_F(OperatorsPlanCacheTest, InstantiateWithParameters) {
+  for (const auto pipelined : {false, true}) {
+    const auto plan = PreparedPlan{create_plan(0, "0", pipelined)};
+    ASSERT_EQ(plan.parameter_count(), 2u);
+    EXPECT_EQ(plan.default_parameters(), (std::vector<AllTypeVariant>{0, "0"}));
+
+    const auto operators = plan.instantiate({50, "3"});
+    // the scans of a pipeline are not executed on their own
+    EXPECT_EQ(operators.size(), pipelined ? 2u : 3u);
+    EXPECT_EQ(operators.back()->description(), pipelined ? "Pipeline [TableScan #0 >= 50, TableScan #1 != 3]"
+                                                         : "TableScan #1 != 3");
+    // 50 of the values are at least 50, 7 of them have the remainder 3
+    EXPECT_EQ(execute(operators), 43u);
+
+    // instances are independent of each other
+    EXPECT_EQ(execute(plan.instantiate({95, "0"})), 4u);
+  }
+}
+
+TEST_F(OperatorsPlanCacheTest, ShapeKey) {
+  EXPECT_EQ(PreparedPlan::shape_key(*create_plan(1, "a", false)), PreparedPlan::shape_key(*create_plan(2, "b", false)));
+  EXPECT_NE(PreparedPlan::shape_key(*create_plan(1, "a", false)), PreparedPlan::shape_key(*create_plan(1, "a", true)));
+  EXPECT_EQ(PreparedPlan::shape_key(*create_plan(1, "a", true)),
+            "Pipeline(TableScan(1 1, TableScan(0 5, GetTable(table_a))))");
+}
+
+TEST_F(OperatorsPlanCacheTest, OutdatedPlans) {
+  auto cache = PlanCache{};
+  const auto plan = cache.get_or_prepare(create_plan(0, "0", false));
+  EXPECT_EQ(cache.get_or_prepare(create_plan(10, "1", false)), plan);
+  EXPECT_TRUE(plan->is_valid());
+
+  // a table with the same name, but other rows
+  StorageManager::get().drop_table("table_a");
+  auto table = std::make_shared<Table>(10);
+  table->add_column("a", "int");
+  table->add_column("b", "string");
+  table->append({60, "1"});
+  StorageManager::get().add_table("table_a", table);
+
+  EXPECT_FALSE(plan->is_valid());
+  EXPECT_EQ(execute(plan->instantiate({50, "3"})), 1u);
+  EXPECT_EQ(cache.get(PreparedPlan::shape_key(*create_plan(0, "0", false))), nullptr);
+  EXPECT_EQ(cache.size(), 0u);
+}
+
+TEST_F(OperatorsPlanCacheTest, EvictsLeastRecentlyUsedPlans) {
+  auto cache = PlanCache{2};
+  const auto plan = std::make_shared<const PreparedPlan>(create_plan(0, "0", false));
+  cache.set("q1", plan);
+  cache.set("q2", plan);
+  EXPECT_EQ(cache.get("q1"), plan);
+  cache.set("q3", plan);
+
+  EXPECT_EQ(cache.size(), 2u);
+  EXPECT_EQ(cache.get("q1"), plan);
+  EXPECT_EQ(cache.get("q2"), nullptr);
+  EXPECT_EQ(cache.get("q3"), plan);
+
+  cache.clear();
+  EXPECT_EQ(cache.size(), 0u);
+}
+
+TEST_F(OperatorsPlanCacheTest, UnsupportedOperator) {
+  const auto pipeline = std::dynamic_pointer_cast<Pipeline>(create_plan(0, "0", true));
+  const auto scan = std::make_shared<TableScan>(pipeline, ColumnID{0}, ScanType::OpEquals, 1);
+  EXPECT_NO_THROW(PreparedPlan{scan});
+
+  class UnknownOperator : public AbstractOperator {
+   public:
+    std::string name() const override { return "UnknownOperator"; }
+
+   protected:
+    std::shared_ptr<const Table> _on_execute() override { return nullptr; }
+  };
+  EXPECT_THROW(PreparedPlan{std::make_shared<UnknownOperator>()}, std::exception);
+}
+
+}  // namespace opossum
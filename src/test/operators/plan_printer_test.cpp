@@ -0,0 +1,118 @@
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/operators/pipeline.hpp"
+#include "../lib/operators/plan_printer.hpp"
+#include "../lib/operators/table_scan.hpp"
+#include "../lib/operators/table_wrapper.hpp"
+#include "../lib/storage/table.hpp"
+
+namespace opossum {
+
+class OperatorsPlanPrinterTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    auto table = std::make_shared<Table>(10);
+    table->add_column("a", "int");
+    for (auto value = 0; value < 100; ++value) {
+      table->append({value});
+    }
+    for (ChunkID chunk_id{0}; chunk_id < 5; ++chunk_id) {
+      table->compress_chunk(chunk_id);
+    }
+    _table_wrapper = std::make_shared<TableWrapper>(table);
+
+    // the first scan prunes the first chunk, whose dictionary only contains the values 0 to 9
+    _scan_1 = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThanEquals, 15);
+    _scan_2 = std::make_shared<TableScan>(_scan_1, ColumnID{0}, ScanType::OpLessThan, 30);
+  }
+
+  void execute_plan() {
+    _table_wrapper->execute();
+    _scan_1->execute();
+    _scan_2->execute();
+  }
+
+  static std::vector<std::string> lines(const std::string& text) {
+    auto lines = std::vector<std::string>{};
+    auto stream = std::istringstream{text};
+    for (auto line = std::string{}; std::getline(stream, line);) {
+      lines.push_back(line);
+    }
+    return lines;
+  }
+
+  std::shared_ptr<TableWrapper> _table_wrapper;
+  std::shared_ptr<TableScan> _scan_1;
+  std::shared_ptr<TableScan> _scan_2;
+};
+
+TEST_F(OperatorsPlanPrinterTest, RecordsPerformanceData) {
+  EXPECT_FALSE(_scan_1->performance_data().executed);
+  execute_plan();
+
+  const auto& performance_data = _scan_1->performance_data();
+  EXPECT_TRUE(performance_data.executed);
+  EXPECT_GT(performance_data.walltime.count(), 0);
+  EXPECT_EQ(performance_data.input_row_count, 100u);
+  EXPECT_EQ(performance_data.input_chunk_count, 10u);
+  EXPECT_EQ(performance_data.output_row_count, 85u);
+  EXPECT_EQ(performance_data.output_chunk_count, 9u);
+  EXPECT_GT(performance_data.allocated_bytes, 0u);
+  EXPECT_EQ(performance_data.pruned_chunk_count, 1u);
+
+  EXPECT_EQ(_scan_2->performance_data().output_row_count, 15u);
+  EXPECT_EQ(_scan_2->performance_data().output_chunk_count, 2u);
+  EXPECT_EQ(_scan_2->performance_data().pruned_chunk_count, 0u);
+}
+
+TEST_F(OperatorsPlanPrinterTest, PrintsText) {
+  auto stream = std::ostringstream{};
+  PlanPrinter::print_text(_scan_2, stream);
+  EXPECT_EQ(lines(stream.str()), (std::vector<std::string>{"TableScan #0 < 30 (not executed)",
+                                                            "`- TableScan #0 >= 15 (not executed)",
+                                                            "   `- TableWrapper (not executed)"}));
+
+  execute_plan();
+  stream.str("");
+  PlanPrinter::print_text(_scan_2, stream);
+  const auto printed_lines = lines(stream.str());
+  ASSERT_EQ(printed_lines.size(), 3u);
+  EXPECT_EQ(printed_lines[0].find("TableScan a < 30 ("), 0u);
+  EXPECT_NE(printed_lines[0].find("in: 85 rows / 9 chunks, out: 15 rows / 2 chunks"), std::string::npos);
+  EXPECT_EQ(printed_lines[1].find("`- TableScan a >= 15 ("), 0u);
+  EXPECT_NE(printed_lines[1].find("1 chunks pruned)"), std::string::npos);
+  EXPECT_EQ(printed_lines[2].find("   `- TableWrapper ("), 0u);
+  EXPECT_EQ(printed_lines[2].find("in:"), std::string::npos);
+}
+
+TEST_F(OperatorsPlanPrinterTest, PrintsDot) {
+  execute_plan();
+  auto stream = std::ostringstream{};
+  PlanPrinter::print_dot(_scan_2, stream);
+  const auto dot = stream.str();
+
+  EXPECT_EQ(dot.find("digraph {\n"), 0u);
+  EXPECT_NE(dot.find("operator_0 [label=\"TableScan a < 30\\n"), std::string::npos);
+  EXPECT_NE(dot.find("operator_2 [label=\"TableWrapper\\n"), std::string::npos);
+  EXPECT_NE(dot.find("operator_1 -> operator_0 [label=\"85 rows\"];"), std::string::npos);
+  EXPECT_NE(dot.find("operator_2 -> operator_1 [label=\"100 rows\"];"), std::string::npos);
+}
+
+TEST_F(OperatorsPlanPrinterTest, DescribesPipelines) {
+  _table_wrapper->execute();
+  auto pipeline = Pipeline::create(_scan_2);
+  pipeline->execute();
+
+  EXPECT_EQ(pipeline->description(), "Pipeline [TableScan a >= 15, TableScan a < 30]");
+  EXPECT_EQ(pipeline->performance_data().output_row_count, 15u);
+  EXPECT_EQ(pipeline->performance_data().pruned_chunk_count, 1u);
+  EXPECT_FALSE(_scan_1->performance_data().executed);
+}
+
+}  // namespace opossum
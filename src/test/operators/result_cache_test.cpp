@@ -0,0 +1,185 @@
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/operators/get_table.hpp"
+#include "../lib/operators/pipeline.hpp"
+#include "../lib/operators/print.hpp"
+#include "../lib/operators/result_cache.hpp"
+#include "../lib/operators/table_scan.hpp"
+#include "../lib/operators/table_wrapper.hpp"
+#include "../lib/storage/storage_manager.hpp"
+#include "../lib/storage/table.hpp"
+#include "../lib/utils/query_arena.hpp"
+
+namespace opossum {
+
+class OperatorsResultCacheTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = std::make_shared<Table>(10);
+    _table->add_column("a", "int");
+    _table->add_column("b", "string");
+    for (auto value = 0; value < 100; ++value) {
+      _table->append({value, std::to_string(value % 7)});
+    }
+    StorageManager::get().add_table("table_a", _table);
+  }
+
+  void TearDown() override { StorageManager::reset(); }
+
+  // the operators of the plan a >= value, optionally on a wrapped table and in a Pipeline
+  static std::vector<std::shared_ptr<AbstractOperator>> create_plan(const AllTypeVariant& value,
+                                                                    const std::shared_ptr<const Table>& table = nullptr,
+                                                                    const bool pipelined = false) {
+    const auto input = table ? std::static_pointer_cast<AbstractOperator>(std::make_shared<TableWrapper>(table))
+                             : std::make_shared<GetTable>("table_a");
+    const auto scan = std::make_shared<TableScan>(input, ColumnID{0}, ScanType::OpGreaterThanEquals, value);
+    if (pipelined) return {input, Pipeline::create(scan)};
+    return {input, scan};
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(OperatorsResultCacheTest, CachesResults) {
+  auto cache = ResultCache{};
+  for (const auto pipelined : {false, true}) {
+    const auto plan = create_plan(50, nullptr, pipelined);
+    const auto result = cache.execute(plan);
+    EXPECT_EQ(result->row_count(), 50u);
+    EXPECT_EQ(result, plan.back()->get_output());
+
+    // the cached result is returned without executing the operators
+    const auto second_plan = create_plan(50, nullptr, pipelined);
+    EXPECT_EQ(cache.get(*second_plan.back()), result);
+    EXPECT_EQ(cache.execute(second_plan), result);
+    EXPECT_EQ(second_plan.back()->get_output(), nullptr);
+  }
+  EXPECT_EQ(cache.size(), 2u);
+  EXPECT_GT(cache.memory_usage(), 0u);
+
+  // other parameters or tables have other results
+  EXPECT_EQ(cache.get(*create_plan(51).back()), nullptr);
+  EXPECT_EQ(cache.get(*create_plan("50").back()), nullptr);
+  EXPECT_EQ(cache.get(*create_plan(50, _table).back()), nullptr);
+  EXPECT_EQ(cache.execute(create_plan(50, _table))->row_count(), 50u);
+  EXPECT_NE(cache.get(*create_plan(50, _table).back()), nullptr);
+
+  cache.clear();
+  EXPECT_EQ(cache.size(), 0u);
+  EXPECT_EQ(cache.memory_usage(), 0u);
+}
+
+TEST_F(OperatorsResultCacheTest, InvalidatesResultsOfChangedTables) {
+  auto cache = ResultCache{};
+  cache.execute(create_plan(50));
+  const auto version = _table->version();
+
+  _table->append({100, "2"});
+  EXPECT_GT(_table->version(), version);
+  EXPECT_EQ(cache.get(*create_plan(50).back()), nullptr);
+  EXPECT_EQ(cache.size(), 0u);
+  EXPECT_EQ(cache.execute(create_plan(50))->row_count(), 51u);
+
+  const auto compressed_version = _table->version();
+  _table->compress_chunk(ChunkID{0});
+  EXPECT_GT(_table->version(), compressed_version);
+  EXPECT_EQ(cache.get(*create_plan(50).back()), nullptr);
+
+  // a new table under the same name
+  cache.execute(create_plan(50));
+  StorageManager::get().drop_table("table_a");
+  auto table = std::make_shared<Table>(10);
+  table->add_column("a", "int");
+  table->add_column("b", "string");
+  table->append({60, "1"});
+  StorageManager::get().add_table("table_a", table);
+  EXPECT_EQ(cache.get(*create_plan(50).back()), nullptr);
+  EXPECT_EQ(cache.execute(create_plan(50))->row_count(), 1u);
+}
+
+TEST_F(OperatorsResultCacheTest, EvictsLeastRecentlyUsedResults) {
+  const auto result_size = ResultCache{}.execute(create_plan(0))->estimate_memory_usage();
+  auto cache = ResultCache{2 * result_size};
+  cache.execute(create_plan(0));
+  cache.execute(create_plan(-1));
+  EXPECT_NE(cache.get(*create_plan(0).back()), nullptr);
+  cache.execute(create_plan(-2));
+
+  EXPECT_EQ(cache.size(), 2u);
+  EXPECT_LE(cache.memory_usage(), 2 * result_size);
+  EXPECT_NE(cache.get(*create_plan(0).back()), nullptr);
+  EXPECT_EQ(cache.get(*create_plan(-1).back()), nullptr);
+  EXPECT_NE(cache.get(*create_plan(-2).back()), nullptr);
+
+  // results that exceed the budget are not cached
+  auto small_cache = ResultCache{result_size - 1};
+  EXPECT_EQ(small_cache.execute(create_plan(0))->row_count(), 100u);
+  EXPECT_EQ(small_cache.size(), 0u);
+}
+
+TEST_F(OperatorsResultCacheTest, DistinguishesNearlyEqualFloatingPointValues) {
+  auto table = std::make_shared<Table>(10);
+  table->add_column("f", "float");
+  table->add_column("d", "double");
+  table->append({0.1f, 1234567.0});
+  table->append({0.1000001f, 1234568.0});
+
+  auto cache = ResultCache{};
+  const auto scan = [&](const ColumnID column_id, const AllTypeVariant& value) {
+    const auto table_wrapper = std::make_shared<TableWrapper>(table);
+    return cache.execute({table_wrapper, std::make_shared<TableScan>(table_wrapper, column_id, ScanType::OpEquals,
+                                                                     value)})
+        ->row_count();
+  };
+  EXPECT_EQ(scan(ColumnID{0}, 0.1f), 1u);
+  EXPECT_EQ(scan(ColumnID{0}, 0.1000001f), 1u);
+  EXPECT_EQ(scan(ColumnID{1}, 1234567.0), 1u);
+  EXPECT_EQ(scan(ColumnID{1}, 1234568.0), 1u);
+  EXPECT_EQ(scan(ColumnID{0}, 0.2f), 0u);
+  EXPECT_EQ(cache.size(), 5u);
+}
+
+TEST_F(OperatorsResultCacheTest, DoesNotCacheResultsOfQueryArenas) {
+  auto cache = ResultCache{};
+  {
+    QueryArena query_arena;
+    EXPECT_TRUE(QueryArena::is_active());
+    EXPECT_EQ(cache.execute(create_plan(50))->row_count(), 50u);
+  }
+  EXPECT_FALSE(QueryArena::is_active());
+  EXPECT_EQ(cache.size(), 0u);
+  EXPECT_EQ(cache.get(*create_plan(50).back()), nullptr);
+
+  // results cached outside of an arena can be used within one
+  cache.execute(create_plan(50));
+  {
+    QueryArena query_arena;
+    EXPECT_NE(cache.get(*create_plan(50).back()), nullptr);
+  }
+  cache.clear();
+}
+
+TEST_F(OperatorsResultCacheTest, UncacheablePlans) {
+  auto cache = ResultCache{};
+  const auto get_table = std::make_shared<GetTable>("table_a");
+  EXPECT_FALSE(ResultCache::is_cacheable(*get_table));
+  EXPECT_EQ(cache.execute({get_table}), _table);
+
+  std::ostringstream output;
+  const auto wrapper = std::make_shared<TableWrapper>(_table);
+  const auto print = std::make_shared<Print>(wrapper, output);
+  EXPECT_FALSE(ResultCache::is_cacheable(*print));
+  cache.execute({wrapper, print});
+  EXPECT_FALSE(output.str().empty());
+
+  EXPECT_TRUE(ResultCache::is_cacheable(*create_plan(0).back()));
+  EXPECT_EQ(cache.size(), 0u);
+}
+
+}  // namespace opossum
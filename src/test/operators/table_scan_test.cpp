@@ -17,6 +17,7 @@
 #include "storage/table.hpp"
 #include "types.hpp"
 #include "utils/load_table.hpp"
+#include "utils/query_arena.hpp"
 
 namespace opossum {
 
@@ -131,6 +132,67 @@ TEST_F(OperatorsTableScanTest, DoubleScan) {
   EXPECT_TABLE_EQ(scan_2->get_output(), expected_result);
 }
 
+TEST_F(OperatorsTableScanTest, OutputChunksReferenceSingleInputChunks) {
+  auto scan_1 = std::make_shared<TableScan>(_table_wrapper_even_dict, ColumnID{0}, ScanType::OpNotEquals, 8);
+  scan_1->execute();
+  auto scan_2 = std::make_shared<TableScan>(scan_1, ColumnID{1}, ScanType::OpGreaterThan, 106);
+  scan_2->execute();
+
+  // one output chunk per input chunk with matches: {110, 112, 114, 116, 118}, {120, 122, 124}
+  const auto output = scan_2->get_output();
+  ASSERT_EQ(output->chunk_count(), 2u);
+  EXPECT_EQ(output->get_chunk(ChunkID{0}).size(), 5u);
+  EXPECT_EQ(output->get_chunk(ChunkID{1}).size(), 3u);
+  ASSERT_COLUMN_EQ(output, ColumnID{1}, {110, 112, 114, 116, 118, 120, 122, 124});
+
+  // the second scan references the stored table directly, and all segments of a chunk share their offsets
+  const auto& chunk = output->get_chunk(ChunkID{1});
+  const auto segment_a = std::static_pointer_cast<const ReferenceSegment>(chunk.get_segment(ColumnID{0}));
+  const auto segment_b = std::static_pointer_cast<const ReferenceSegment>(chunk.get_segment(ColumnID{1}));
+  ASSERT_TRUE(segment_a->references_single_chunk());
+  EXPECT_EQ(segment_a->referenced_table(), _table_wrapper_even_dict->get_output());
+  EXPECT_EQ(segment_a->referenced_chunk_id(), ChunkID{2});
+  EXPECT_EQ(*segment_a->chunk_offsets(), (ChunkOffsetList{0, 1, 2}));
+  EXPECT_EQ(segment_a->chunk_offsets(), segment_b->chunk_offsets());
+  EXPECT_EQ(segment_b->row_id(1), (RowID{ChunkID{2}, 1}));
+}
+
+TEST_F(OperatorsTableScanTest, NonSelectiveScansUseSelectionBitmaps) {
+  auto table = std::make_shared<Table>(1000);
+  table->add_column("a", "int");
+  for (auto value = 0; value < 1000; ++value) table->append({value});
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+  const auto first_segment = [](const std::shared_ptr<TableScan>& scan) {
+    const auto segment = scan->get_output()->get_chunk(ChunkID{0}).get_segment(ColumnID{0});
+    return std::static_pointer_cast<const ReferenceSegment>(segment);
+  };
+
+  auto scan_1 = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpGreaterThanEquals, 100);
+  scan_1->execute();
+  const auto segment_1 = first_segment(scan_1);
+  ASSERT_NE(segment_1->selection_bitmap(), nullptr);
+  EXPECT_EQ(segment_1->size(), 900u);
+  EXPECT_EQ(segment_1->row_id(0), (RowID{ChunkID{0}, 100}));
+
+  // the second scan refines the bitmap of the first one
+  auto scan_2 = std::make_shared<TableScan>(scan_1, ColumnID{0}, ScanType::OpNotEquals, 500);
+  scan_2->execute();
+  const auto segment_2 = first_segment(scan_2);
+  ASSERT_NE(segment_2->selection_bitmap(), nullptr);
+  EXPECT_EQ(segment_2->referenced_table(), table);
+  EXPECT_EQ(segment_2->size(), 899u);
+  EXPECT_FALSE(segment_2->selection_bitmap()->is_selected(500));
+  EXPECT_EQ((*segment_2)[400], AllTypeVariant{501});
+
+  // selective predicates still result in chunk offsets
+  auto scan_3 = std::make_shared<TableScan>(scan_2, ColumnID{0}, ScanType::OpLessThan, 110);
+  scan_3->execute();
+  const auto segment_3 = first_segment(scan_3);
+  ASSERT_NE(segment_3->chunk_offsets(), nullptr);
+  EXPECT_EQ(segment_3->materialize_values<int>(), (pmr_vector<int>{100, 101, 102, 103, 104, 105, 106, 107, 108, 109}));
+}
+
 TEST_F(OperatorsTableScanTest, EmptyResultScan) {
   auto scan_1 = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThan, 90000);
   scan_1->execute();
@@ -188,6 +250,59 @@ TEST_F(OperatorsTableScanTest, ScanOnReferencedDictColumn) {
   }
 }
 
+TEST_F(OperatorsTableScanTest, ScanOnPosListReferencingSeveralChunks) {
+  // the positions alternate between the DictionarySegments and the ValueSegment of the referenced table
+  auto table = std::make_shared<Table>(5);
+  table->add_column("a", "int");
+  for (auto value = 0; value < 15; ++value) table->append({value});
+  table->compress_chunk(ChunkID{0});
+  table->compress_chunk(ChunkID{2});
+
+  const auto values = std::vector<int>{12, 3, 7, 0, 14, 8, 1, 11};
+  auto pos_list = std::make_shared<PosList>();
+  for (const auto value : values) {
+    pos_list->emplace_back(RowID{ChunkID{static_cast<uint32_t>(value / 5)}, static_cast<ChunkOffset>(value % 5)});
+  }
+  auto chunk = Chunk{};
+  chunk.add_segment(std::make_shared<ReferenceSegment>(table, ColumnID{0}, pos_list));
+  auto reference_table = std::make_shared<Table>();
+  reference_table->add_column("a", "int");
+  reference_table->emplace_chunk(std::move(chunk));
+  auto table_wrapper = std::make_shared<TableWrapper>(reference_table);
+  table_wrapper->execute();
+
+  const auto matches = [](const int value, const ScanType scan_type, const int search_value) {
+    switch (scan_type) {
+      case ScanType::OpEquals:
+        return value == search_value;
+      case ScanType::OpNotEquals:
+        return value != search_value;
+      case ScanType::OpLessThan:
+        return value < search_value;
+      case ScanType::OpLessThanEquals:
+        return value <= search_value;
+      case ScanType::OpGreaterThan:
+        return value > search_value;
+      case ScanType::OpGreaterThanEquals:
+        return value >= search_value;
+    }
+    return false;
+  };
+  for (const auto scan_type : {ScanType::OpEquals, ScanType::OpNotEquals, ScanType::OpLessThan,
+                               ScanType::OpLessThanEquals, ScanType::OpGreaterThan, ScanType::OpGreaterThanEquals}) {
+    for (const auto search_value : {-1, 0, 3, 7, 9, 11, 14, 20}) {
+      auto expected = std::vector<AllTypeVariant>{};
+      for (const auto value : values) {
+        if (matches(value, scan_type, search_value)) expected.emplace_back(value);
+      }
+      auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, scan_type, search_value);
+      scan->execute();
+      EXPECT_EQ(scan->get_output()->row_count(), expected.size());
+      ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{0}, expected);
+    }
+  }
+}
+
 TEST_F(OperatorsTableScanTest, ScanPartiallyCompressed) {
   std::shared_ptr<Table> expected_result = load_table("src/test/tables/int_float_seq_filtered.tbl", 2);
 
@@ -257,6 +372,47 @@ TEST_F(OperatorsTableScanTest, ScanOnDictColumnAroundBounds) {
   }
 }
 
+TEST_F(OperatorsTableScanTest, ScanAllocatesFromQueryArena) {
+  QueryArena query_arena;
+  auto scan = std::make_shared<opossum::TableScan>(_table_wrapper_even_dict, ColumnID{0}, ScanType::OpLessThan, 6);
+  scan->execute();
+
+  const auto segment = scan->get_output()->get_chunk(ChunkID{0}).get_segment(ColumnID{0});
+  const auto chunk_offsets = std::static_pointer_cast<const ReferenceSegment>(segment)->chunk_offsets();
+  EXPECT_EQ(chunk_offsets->get_allocator().resource(), query_arena.memory_resource());
+  ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{1}, {100, 102, 104});
+}
+
+TEST_F(OperatorsTableScanTest, PrunesChunksByDictionary) {
+  // the dictionaries of the first two chunks contain 0, 2, ..., 8 and 10, 12, ..., 18, the third one is not compressed
+  const auto pruned_chunk_count = [&](const ScanType scan_type, const int search_value) {
+    auto scan = std::make_shared<TableScan>(_table_wrapper_even_dict, ColumnID{0}, scan_type, search_value);
+    scan->execute();
+    return scan->performance_data().pruned_chunk_count;
+  };
+  EXPECT_EQ(pruned_chunk_count(ScanType::OpEquals, 4), 1u);
+  EXPECT_EQ(pruned_chunk_count(ScanType::OpEquals, 5), 2u);
+  EXPECT_EQ(pruned_chunk_count(ScanType::OpNotEquals, 4), 0u);
+  EXPECT_EQ(pruned_chunk_count(ScanType::OpLessThan, 10), 1u);
+  EXPECT_EQ(pruned_chunk_count(ScanType::OpLessThanEquals, 8), 1u);
+  EXPECT_EQ(pruned_chunk_count(ScanType::OpGreaterThan, 8), 1u);
+  EXPECT_EQ(pruned_chunk_count(ScanType::OpGreaterThanEquals, 20), 2u);
+
+  // a chunk in which all values equal the search value is pruned by OpNotEquals
+  auto table = std::make_shared<Table>(2);
+  table->add_column("a", "int");
+  table->append({7});
+  table->append({7});
+  table->append({8});
+  table->compress_chunk(ChunkID{0});
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+  auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpNotEquals, 7);
+  scan->execute();
+  EXPECT_EQ(scan->performance_data().pruned_chunk_count, 1u);
+  EXPECT_EQ(scan->get_output()->row_count(), 1u);
+}
+
 TEST_F(OperatorsTableScanTest, ScanWithEmptyInput) {
   auto scan_1 = std::make_shared<opossum::TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThan, 12345);
   scan_1->execute();
@@ -0,0 +1,92 @@
+#include <atomic>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/import_csv.hpp"
+#include "scheduler/chunk_workers.hpp"
+#include "scheduler/topology.hpp"
+#include "storage/table.hpp"
+#include "utils/load_table.hpp"
+
+namespace opossum {
+
+class SchedulerTopologyTest : public BaseTest {
+ protected:
+  void SetUp() override { Topology::get().use_simulated_topology(3, 2); }
+
+  void TearDown() override { Topology::reset(); }
+};
+
+TEST_F(SchedulerTopologyTest, SystemTopology) {
+  Topology::reset();
+  EXPECT_FALSE(Topology::get().is_simulated());
+  ASSERT_GE(Topology::get().node_count(), 1u);
+  EXPECT_FALSE(Topology::get().nodes()[0].cpu_ids.empty());
+
+  // the NodeIDs are consecutive, while the ids of the operating system may have gaps
+  for (auto node_id = NodeID{1}; node_id < Topology::get().node_count(); ++node_id) {
+    EXPECT_GT(Topology::get().nodes()[node_id].os_node_id, Topology::get().nodes()[node_id - 1].os_node_id);
+  }
+}
+
+TEST_F(SchedulerTopologyTest, SimulatedTopology) {
+  const auto& topology = Topology::get();
+  EXPECT_TRUE(topology.is_simulated());
+  EXPECT_EQ(topology.node_count(), 3u);
+  for (const auto& node : topology.nodes()) {
+    EXPECT_EQ(node.cpu_ids.size(), 2u);
+  }
+}
+
+TEST_F(SchedulerTopologyTest, ChunkPlacement) {
+  const auto& topology = Topology::get();
+  const auto round_robin = std::vector<NodeID>{NodeID{0}, NodeID{1}, NodeID{2}, NodeID{0}, NodeID{1}, NodeID{2}};
+  const auto partitioned = std::vector<NodeID>{NodeID{0}, NodeID{0}, NodeID{1}, NodeID{1}, NodeID{2}, NodeID{2}};
+  for (ChunkID chunk_id{0}; chunk_id < 6; ++chunk_id) {
+    EXPECT_EQ(topology.node_for_chunk(chunk_id, 6, ChunkPlacement::RoundRobin), round_robin[chunk_id]);
+    EXPECT_EQ(topology.node_for_chunk(chunk_id, 6, ChunkPlacement::Partitioned), partitioned[chunk_id]);
+  }
+}
+
+TEST_F(SchedulerTopologyTest, WorkersArePinnedToNodes) {
+  EXPECT_EQ(Topology::current_node_id(), UNKNOWN_NODE_ID);
+
+  auto calls = std::vector<std::atomic<uint32_t>>(20);
+  auto pinned_correctly = std::atomic<bool>{true};
+  const auto node_of_chunk = [](const ChunkID chunk_id) { return static_cast<NodeID>(chunk_id % 3); };
+  for_each_chunk_on_owning_node(calls.size(), node_of_chunk, [&](const ChunkID chunk_id, const NodeID worker_node_id) {
+    ++calls[chunk_id];
+    if (Topology::current_node_id() != worker_node_id) pinned_correctly = false;
+  });
+
+  EXPECT_TRUE(pinned_correctly);
+  for (const auto& call_count : calls) {
+    EXPECT_EQ(call_count, 1u);
+  }
+}
+
+TEST_F(SchedulerTopologyTest, WorkerExceptionsArePropagated) {
+  const auto node_of_chunk = [](const ChunkID) { return NodeID{0}; };
+  EXPECT_THROW(for_each_chunk_on_owning_node(4, node_of_chunk,
+                                             [](const ChunkID chunk_id, const NodeID) {
+                                               if (chunk_id == 2) throw std::logic_error("failed");
+                                             }),
+               std::logic_error);
+}
+
+TEST_F(SchedulerTopologyTest, ImportRecordsNodes) {
+  const auto table = ImportCsv::read_table("src/test/tables/int_float.tbl", 1, false, '|', ChunkPlacement::Partitioned);
+  EXPECT_TABLE_EQ(table, load_table("src/test/tables/int_float.tbl", 1), true);
+  for (ChunkID chunk_id{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    EXPECT_LT(table->get_chunk(chunk_id).node_id(), 3u);
+  }
+
+  table->compress_chunk(ChunkID{0});
+  EXPECT_LT(table->get_chunk(ChunkID{0}).node_id(), 3u);
+}
+
+}  // namespace opossum
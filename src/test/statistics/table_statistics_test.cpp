@@ -0,0 +1,211 @@
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/operators/get_table.hpp"
+#include "../lib/operators/pipeline.hpp"
+#include "../lib/operators/table_scan.hpp"
+#include "../lib/operators/table_wrapper.hpp"
+#include "../lib/statistics/column_statistics.hpp"
+#include "../lib/statistics/table_statistics.hpp"
+#include "../lib/storage/storage_manager.hpp"
+#include "../lib/storage/table.hpp"
+
+namespace opossum {
+
+class StatisticsTableStatisticsTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // a is 0..999, b is a % 10, c is one of 20 strings
+    _table = std::make_shared<Table>(100);
+    _table->add_column("a", "int");
+    _table->add_column("b", "double");
+    _table->add_column("c", "string");
+    for (auto value = 0; value < 1000; ++value) {
+      _table->append({value, static_cast<double>(value % 10), "value_" + std::to_string(100 + value % 20)});
+    }
+  }
+
+  void TearDown() override { StorageManager::reset(); }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(StatisticsTableStatisticsTest, ColumnStatistics) {
+  const auto statistics = TableStatistics{*_table, 10};
+  EXPECT_EQ(statistics.row_count(), 1000u);
+  EXPECT_EQ(statistics.table_version(), _table->version());
+
+  const auto& a = statistics.column_statistics(ColumnID{0});
+  EXPECT_EQ(a.row_count(), 1000u);
+  EXPECT_EQ(a.distinct_count(), 1000u);
+  EXPECT_EQ(a.null_fraction(), 0.0f);
+  EXPECT_EQ(a.min(), AllTypeVariant{0});
+  EXPECT_EQ(a.max(), AllTypeVariant{999});
+  EXPECT_EQ(a.bucket_count(), 10u);
+
+  // every bucket of an equi-depth histogram has about the same number of rows
+  for (const auto& bucket : dynamic_cast<const ColumnStatistics<int>&>(a).buckets()) {
+    EXPECT_EQ(bucket.row_count, 100u);
+    EXPECT_EQ(bucket.distinct_count, 100u);
+  }
+
+  const auto& b = statistics.column_statistics(ColumnID{1});
+  EXPECT_EQ(b.distinct_count(), 10u);
+  EXPECT_EQ(b.max(), AllTypeVariant{9.0});
+
+  const auto& c = statistics.column_statistics(ColumnID{2});
+  EXPECT_EQ(c.distinct_count(), 20u);
+  EXPECT_EQ(c.min(), AllTypeVariant{"value_100"});
+  EXPECT_EQ(c.max(), AllTypeVariant{"value_119"});
+}
+
+TEST_F(StatisticsTableStatisticsTest, ChunkStatistics) {
+  // compressed chunks are counted by their ValueIDs, also with a dictionary that contains values of other chunks
+  _table->compress_chunk(ChunkID{0});
+  _table->compress_chunk(ChunkID{1}, DictionaryScope::Column);
+  _table->compress_chunk(ChunkID{2}, DictionaryScope::Column);
+
+  const auto statistics = TableStatistics{*_table};
+  ASSERT_EQ(statistics.chunk_count(), 10u);
+  for (ChunkID chunk_id{0}; chunk_id < statistics.chunk_count(); ++chunk_id) {
+    const auto& a = statistics.chunk_column_statistics(chunk_id, ColumnID{0});
+    EXPECT_EQ(a.row_count(), 100u);
+    EXPECT_EQ(a.distinct_count(), 100u);
+    EXPECT_EQ(a.min(), AllTypeVariant{static_cast<int>(chunk_id) * 100});
+    EXPECT_EQ(a.max(), AllTypeVariant{static_cast<int>(chunk_id) * 100 + 99});
+    EXPECT_EQ(statistics.chunk_column_statistics(chunk_id, ColumnID{1}).distinct_count(), 10u);
+    EXPECT_EQ(statistics.chunk_column_statistics(chunk_id, ColumnID{2}).distinct_count(), 20u);
+  }
+  EXPECT_EQ(statistics.column_statistics(ColumnID{0}).distinct_count(), 1000u);
+  EXPECT_EQ(statistics.column_statistics(ColumnID{2}).distinct_count(), 20u);
+}
+
+TEST_F(StatisticsTableStatisticsTest, EstimateScanRowCount) {
+  const auto statistics = TableStatistics{*_table};
+  const auto estimate = [&](const ColumnID column_id, const ScanType scan_type, const AllTypeVariant& value) {
+    return statistics.estimate_scan_row_count(column_id, scan_type, value);
+  };
+
+  EXPECT_NEAR(estimate(ColumnID{0}, ScanType::OpEquals, 500), 1.0, 0.01);
+  EXPECT_EQ(estimate(ColumnID{0}, ScanType::OpEquals, 1000), 0.0);
+  EXPECT_EQ(estimate(ColumnID{0}, ScanType::OpEquals, -1), 0.0);
+  EXPECT_NEAR(estimate(ColumnID{0}, ScanType::OpNotEquals, 500), 999.0, 0.01);
+  EXPECT_NEAR(estimate(ColumnID{0}, ScanType::OpLessThan, 250), 250.0, 5.0);
+  EXPECT_NEAR(estimate(ColumnID{0}, ScanType::OpLessThanEquals, 250), 251.0, 5.0);
+  EXPECT_NEAR(estimate(ColumnID{0}, ScanType::OpGreaterThan, 900), 99.0, 5.0);
+  EXPECT_NEAR(estimate(ColumnID{0}, ScanType::OpGreaterThanEquals, 900), 100.0, 5.0);
+  EXPECT_EQ(estimate(ColumnID{0}, ScanType::OpGreaterThanEquals, 0), 1000.0);
+  EXPECT_EQ(estimate(ColumnID{0}, ScanType::OpLessThan, 0), 0.0);
+
+  // the search value is converted to the type of the column
+  EXPECT_NEAR(estimate(ColumnID{1}, ScanType::OpEquals, 3), 100.0, 0.01);
+  EXPECT_NEAR(estimate(ColumnID{1}, ScanType::OpLessThan, 3.0), 300.0, 50.0);
+  EXPECT_NEAR(estimate(ColumnID{2}, ScanType::OpEquals, "value_105"), 50.0, 0.01);
+  EXPECT_NEAR(estimate(ColumnID{2}, ScanType::OpLessThan, "value_110"), 500.0, 100.0);
+  EXPECT_EQ(estimate(ColumnID{2}, ScanType::OpEquals, "other"), 0.0);
+
+  EXPECT_NEAR(statistics.column_statistics(ColumnID{0}).estimate_selectivity(ScanType::OpLessThan, 100), 0.1, 0.01);
+}
+
+TEST_F(StatisticsTableStatisticsTest, EstimatePlanRowCount) {
+  StorageManager::get().add_table("table_a", _table);
+  const auto get_table = std::make_shared<GetTable>("table_a");
+  const auto scan_1 = std::make_shared<TableScan>(get_table, ColumnID{0}, ScanType::OpLessThan, 500);
+  const auto scan_2 = std::make_shared<TableScan>(scan_1, ColumnID{1}, ScanType::OpEquals, 3.0);
+
+  EXPECT_EQ(TableStatistics::estimate_row_count(*get_table), 1000.0);
+  EXPECT_NEAR(TableStatistics::estimate_row_count(*scan_1), 500.0, 10.0);
+  EXPECT_NEAR(TableStatistics::estimate_row_count(*scan_2), 50.0, 1.0);
+  EXPECT_NEAR(TableStatistics::estimate_row_count(*Pipeline::create(scan_2)), 50.0, 1.0);
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(_table);
+  EXPECT_NEAR(TableStatistics::estimate_row_count(
+                  TableScan{table_wrapper, ColumnID{2}, ScanType::OpNotEquals, "value_100"}),
+              950.0, 1.0);
+}
+
+TEST_F(StatisticsTableStatisticsTest, TableStatisticsAreUpdated) {
+  const auto statistics = _table->table_statistics();
+  EXPECT_EQ(_table->table_statistics(), statistics);
+  EXPECT_EQ(statistics->row_count(), 1000u);
+
+  _table->append({1000, 0.0, "value_100"});
+  const auto updated_statistics = _table->table_statistics();
+  EXPECT_NE(updated_statistics, statistics);
+  EXPECT_EQ(updated_statistics->row_count(), 1001u);
+  EXPECT_EQ(updated_statistics->column_statistics(ColumnID{0}).max(), AllTypeVariant{1000});
+  EXPECT_EQ(updated_statistics->chunk_count(), 11u);
+}
+
+TEST_F(StatisticsTableStatisticsTest, StatisticsOfCompressedChunksAreReused) {
+  _table->compress_chunk(ChunkID{0});
+  _table->compress_chunk(ChunkID{1}, DictionaryScope::Column);
+  const auto statistics = _table->table_statistics();
+
+  _table->append({1000, 0.0, "value_100"});
+  const auto updated_statistics = _table->table_statistics();
+  for (ColumnID column_id{0}; column_id < _table->column_count(); ++column_id) {
+    EXPECT_EQ(&updated_statistics->chunk_column_statistics(ChunkID{0}, column_id),
+              &statistics->chunk_column_statistics(ChunkID{0}, column_id));
+    EXPECT_EQ(&updated_statistics->chunk_column_statistics(ChunkID{1}, column_id),
+              &statistics->chunk_column_statistics(ChunkID{1}, column_id));
+    EXPECT_NE(&updated_statistics->chunk_column_statistics(ChunkID{2}, column_id),
+              &statistics->chunk_column_statistics(ChunkID{2}, column_id));
+  }
+  // the reused values are counted for the table
+  EXPECT_EQ(updated_statistics->row_count(), 1001u);
+  EXPECT_EQ(updated_statistics->column_statistics(ColumnID{0}).distinct_count(), 1001u);
+  EXPECT_EQ(updated_statistics->column_statistics(ColumnID{0}).min(), AllTypeVariant{0});
+  EXPECT_EQ(updated_statistics->column_statistics(ColumnID{2}).distinct_count(), 20u);
+
+  // a chunk that is compressed is replaced, so that its statistics are computed again and reused afterwards
+  _table->compress_chunk(ChunkID{2});
+  const auto compressed_statistics = _table->table_statistics();
+  EXPECT_NE(&compressed_statistics->chunk_column_statistics(ChunkID{2}, ColumnID{0}),
+            &updated_statistics->chunk_column_statistics(ChunkID{2}, ColumnID{0}));
+  EXPECT_EQ(&compressed_statistics->chunk_column_statistics(ChunkID{1}, ColumnID{0}),
+            &updated_statistics->chunk_column_statistics(ChunkID{1}, ColumnID{0}));
+  EXPECT_EQ(compressed_statistics->chunk_column_statistics(ChunkID{2}, ColumnID{0}).distinct_count(), 100u);
+  EXPECT_EQ(compressed_statistics->row_count(), 1001u);
+
+  _table->append({1001, 0.0, "value_100"});
+  EXPECT_EQ(&_table->table_statistics()->chunk_column_statistics(ChunkID{2}, ColumnID{0}),
+            &compressed_statistics->chunk_column_statistics(ChunkID{2}, ColumnID{0}));
+}
+
+TEST_F(StatisticsTableStatisticsTest, StatisticsWhileRowsAreAppended) {
+  auto table = std::make_shared<Table>();
+  table->add_column("a", "int");
+  table->add_column("b", "string");
+  auto appender = std::thread([&] {
+    for (auto value = 0; value < 10'000; ++value) {
+      table->append({value, std::to_string(value)});
+    }
+  });
+
+  // all columns contain the same rows, although they are appended to the open chunk while the statistics are computed
+  for (auto iteration = 0; iteration < 100; ++iteration) {
+    const auto statistics = TableStatistics{*table};
+    EXPECT_EQ(statistics.column_statistics(ColumnID{0}).row_count(), statistics.row_count());
+    EXPECT_EQ(statistics.column_statistics(ColumnID{1}).row_count(), statistics.row_count());
+  }
+  appender.join();
+  EXPECT_EQ(TableStatistics{*table}.row_count(), 10'000u);
+}
+
+TEST_F(StatisticsTableStatisticsTest, EmptyTable) {
+  auto table = Table{};
+  table.add_column("a", "int");
+  const auto statistics = TableStatistics{table};
+  EXPECT_EQ(statistics.row_count(), 0u);
+  EXPECT_EQ(statistics.column_statistics(ColumnID{0}).distinct_count(), 0u);
+  EXPECT_EQ(statistics.estimate_scan_row_count(ColumnID{0}, ScanType::OpNotEquals, 1), 0.0);
+  EXPECT_THROW(statistics.column_statistics(ColumnID{0}).min(), std::exception);
+}
+
+}  // namespace opossum
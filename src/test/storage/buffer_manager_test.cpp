@@ -0,0 +1,177 @@
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <memory>
+#include <string>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/operators/table_scan.hpp"
+#include "../lib/operators/table_wrapper.hpp"
+#include "../lib/storage/buffer_manager.hpp"
+#include "../lib/storage/chunk.hpp"
+#include "../lib/storage/dictionary_segment.hpp"
+#include "../lib/storage/table.hpp"
+
+namespace opossum {
+
+class StorageBufferManagerTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    mkdir(_spill_directory.c_str(), 0755);
+    BufferManager::get().set_spill_directory(_spill_directory);
+  }
+
+  void TearDown() override {
+    BufferManager::reset();
+    rmdir(_spill_directory.c_str());
+  }
+
+  // creates a table with ten chunks of ten rows each
+  static std::shared_ptr<Table> _create_table() {
+    auto table = std::make_shared<Table>(10);
+    table->add_column("a", "int");
+    table->add_column("b", "string");
+    for (auto value = 0; value < 100; ++value) {
+      table->append({value, "value " + std::to_string(value)});
+    }
+    return table;
+  }
+
+  static void _compress(Table& table) {
+    for (ChunkID chunk_id{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+      table.compress_chunk(chunk_id);
+    }
+  }
+
+  static size_t _resident_chunk_count(const Table& table) {
+    auto count = size_t{0};
+    for (ChunkID chunk_id{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+      if (table.get_chunk(chunk_id).is_resident()) ++count;
+    }
+    return count;
+  }
+
+  const std::string _spill_directory = "buffer_manager_test_spill";
+};
+
+TEST_F(StorageBufferManagerTest, DisabledByDefault) {
+  const auto table = _create_table();
+  _compress(*table);
+  EXPECT_EQ(BufferManager::get().resident_memory_usage(), 0u);
+  EXPECT_EQ(_resident_chunk_count(*table), 10u);
+}
+
+TEST_F(StorageBufferManagerTest, EvictsChunksBeyondBudget) {
+  const auto expected = _create_table();
+  const auto table = _create_table();
+  _compress(*expected);
+
+  const auto chunk_memory_usage = expected->get_chunk(ChunkID{0}).estimate_memory_usage();
+  BufferManager::get().set_memory_budget(3 * chunk_memory_usage);
+  _compress(*table);
+
+  EXPECT_LE(BufferManager::get().resident_memory_usage(), 3 * chunk_memory_usage);
+  EXPECT_LE(_resident_chunk_count(*table), 3u);
+  EXPECT_EQ(table->get_chunk(ChunkID{0}).size(), 10u);
+  EXPECT_EQ(table->get_chunk(ChunkID{0}).column_count(), 2u);
+
+  // evicted segments are loaded transparently, while other chunks are evicted to stay within the budget
+  EXPECT_TABLE_EQ(table, expected, true);
+  EXPECT_LE(BufferManager::get().resident_memory_usage(), 3 * chunk_memory_usage);
+}
+
+TEST_F(StorageBufferManagerTest, PinnedChunksAreNotEvicted) {
+  const auto table = _create_table();
+  BufferManager::get().set_memory_budget(1);
+  _compress(*table);
+  EXPECT_EQ(_resident_chunk_count(*table), 0u);
+
+  const auto& chunk = table->get_chunk(ChunkID{4});
+  {
+    const ChunkPin chunk_pin(chunk);
+    EXPECT_TRUE(chunk.is_resident());
+
+    table->get_chunk(ChunkID{5}).get_segment(ColumnID{0});
+    BufferManager::get().enforce_memory_budget();
+    EXPECT_TRUE(chunk.is_resident());
+    EXPECT_FALSE(table->get_chunk(ChunkID{5}).is_resident());
+    EXPECT_EQ((*chunk.get_segment(ColumnID{1}))[3], AllTypeVariant{"value 43"});
+  }
+
+  BufferManager::get().enforce_memory_budget();
+  EXPECT_FALSE(chunk.is_resident());
+}
+
+TEST_F(StorageBufferManagerTest, RaisingBudgetKeepsChunksLoaded) {
+  const auto table = _create_table();
+  BufferManager::get().set_memory_budget(1);
+  _compress(*table);
+
+  BufferManager::get().set_memory_budget(table->estimate_memory_usage() * 10);
+  for (ChunkID chunk_id{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    table->get_chunk(chunk_id).get_segment(ColumnID{0});
+  }
+  EXPECT_EQ(_resident_chunk_count(*table), 10u);
+}
+
+TEST_F(StorageBufferManagerTest, TableScanOnEvictedChunks) {
+  const auto table = _create_table();
+  BufferManager::get().set_memory_budget(1);
+  _compress(*table);
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+  auto table_scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpGreaterThanEquals, 95);
+  table_scan->execute();
+
+  const auto result = table_scan->get_output();
+  ASSERT_EQ(result->row_count(), 5u);
+  for (ChunkOffset chunk_offset{0}; chunk_offset < 5; ++chunk_offset) {
+    EXPECT_EQ((*result->get_chunk(ChunkID{0}).get_segment(ColumnID{1}))[chunk_offset],
+              AllTypeVariant{"value " + std::to_string(95 + chunk_offset)});
+  }
+}
+
+TEST_F(StorageBufferManagerTest, SharedDictionariesAreNotSpilled) {
+  const auto expected = _create_table();
+  const auto table = _create_table();
+  _compress(*expected);
+
+  BufferManager::get().set_memory_budget(1);
+  for (ChunkID chunk_id{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    table->compress_chunk(chunk_id, DictionaryScope::Column);
+  }
+  table->unify_dictionary(ColumnID{0});
+  table->unify_dictionary(ColumnID{1});
+  EXPECT_EQ(_resident_chunk_count(*table), 0u);
+
+  // the dictionaries are counted once, although all of the evicted chunks share them
+  const auto dictionary = std::dynamic_pointer_cast<const DictionarySegment<std::string>>(
+                              table->get_chunk(ChunkID{9}).get_segment(ColumnID{1}))
+                              ->dictionary();
+  BufferManager::get().enforce_memory_budget();
+  EXPECT_EQ(_resident_chunk_count(*table), 0u);
+  EXPECT_GE(BufferManager::get().resident_memory_usage(), vector_heap_size(*dictionary));
+  EXPECT_LT(BufferManager::get().resident_memory_usage(), 2 * (sizeof(*dictionary) + vector_heap_size(*dictionary)));
+
+  // reloaded segments share the dictionary again
+  for (ChunkID chunk_id{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    const auto segment = table->get_chunk(chunk_id).get_segment(ColumnID{1});
+    EXPECT_EQ(std::dynamic_pointer_cast<const DictionarySegment<std::string>>(segment)->dictionary(), dictionary);
+  }
+  EXPECT_TABLE_EQ(table, expected, true);
+}
+
+TEST_F(StorageBufferManagerTest, SpillFilesAreRemoved) {
+  {
+    const auto table = _create_table();
+    BufferManager::get().set_memory_budget(1);
+    _compress(*table);
+  }
+  // rmdir only succeeds for empty directories
+  EXPECT_EQ(rmdir(_spill_directory.c_str()), 0);
+}
+
+}  // namespace opossum
@@ -1,5 +1,6 @@
 #include <limits>
 #include <memory>
+#include <memory_resource>
 #include <string>
 
 #include "gtest/gtest.h"
@@ -115,6 +116,31 @@ TEST_F(StorageDictionarySegmentTest, Immutability) {
   EXPECT_THROW(col->append("Not allowed!!!!"), std::exception);
 }
 
+TEST_F(StorageDictionarySegmentTest, UsesGivenAllocator) {
+  std::pmr::monotonic_buffer_resource memory_resource;
+  const auto allocator = opossum::PolymorphicAllocator<std::string>{&memory_resource};
+
+  auto value_segment = std::make_shared<opossum::ValueSegment<std::string>>(allocator);
+  value_segment->append("Bill");
+  value_segment->append("Steve");
+  EXPECT_EQ(value_segment->values().get_allocator().resource(), &memory_resource);
+
+  const auto dict_col = std::make_shared<opossum::DictionarySegment<std::string>>(value_segment, allocator);
+  EXPECT_EQ(dict_col->dictionary()->get_allocator().resource(), &memory_resource);
+  EXPECT_EQ(dict_col->get(1), "Steve");
+}
+
+TEST_F(StorageDictionarySegmentTest, EstimateMemoryUsage) {
+  for (auto value = 0; value < 1000; ++value) vc_int->append(value % 10);
+  auto col = opossum::make_shared_by_data_type<opossum::BaseSegment, opossum::DictionarySegment>("int", vc_int);
+  auto dict_col = std::dynamic_pointer_cast<opossum::DictionarySegment<int>>(col);
+
+  // 1000 one-byte value ids plus a dictionary of 10 ints
+  EXPECT_GE(dict_col->estimate_memory_usage(), 1000u + 10u * sizeof(int));
+  EXPECT_GE(dict_col->estimate_memory_usage(), dict_col->attribute_vector()->estimate_memory_usage());
+  EXPECT_LT(dict_col->estimate_memory_usage(), vc_int->estimate_memory_usage());
+}
+
 TEST_F(StorageDictionarySegmentTest, AttributeWidthWideEnough) {
   vc_int->append(0);
   auto col = opossum::make_shared_by_data_type<opossum::BaseSegment, opossum::DictionarySegment>("int", vc_int);
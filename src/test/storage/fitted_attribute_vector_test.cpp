@@ -12,7 +12,7 @@ namespace opossum {
 class StorageFittedAttributeVectorTest : public BaseTest {
  protected:
   std::shared_ptr<BaseAttributeVector> vector =
-      std::make_shared<FittedAttributeVector<uint8_t>>(std::vector<uint8_t>{3, 4});
+      std::make_shared<FittedAttributeVector<uint8_t>>(pmr_vector<uint8_t>{3, 4});
 };
 
 TEST_F(StorageFittedAttributeVectorTest, Size) { EXPECT_EQ(vector->size(), 2u); }
@@ -41,10 +41,10 @@ TEST_F(StorageFittedAttributeVectorTest, GetSetInvalidValues) {
 TEST_F(StorageFittedAttributeVectorTest, Width) {
   EXPECT_EQ(vector->width(), 1u);
 
-  vector = std::make_shared<FittedAttributeVector<uint16_t>>(std::vector<uint16_t>{42, 43});
+  vector = std::make_shared<FittedAttributeVector<uint16_t>>(pmr_vector<uint16_t>{42, 43});
   EXPECT_EQ(vector->width(), 2u);
 
-  vector = std::make_shared<FittedAttributeVector<uint32_t>>(std::vector<uint32_t>{44, 45});
+  vector = std::make_shared<FittedAttributeVector<uint32_t>>(pmr_vector<uint32_t>{44, 45});
   EXPECT_EQ(vector->width(), 4u);
 }
 
@@ -102,4 +102,16 @@ TEST_F(ReferenceSegmentTest, RetrievesValuesFromChunks) {
   EXPECT_EQ(reference_segment[2], column_2[1]);
 }
 
+TEST_F(ReferenceSegmentTest, RetrievesValuesByChunkOffsets) {
+  auto chunk_offsets = std::make_shared<ChunkOffsetList>(std::initializer_list<ChunkOffset>({1, 0}));
+  auto reference_segment = ReferenceSegment(_test_table, ColumnID{0}, ChunkID{1}, chunk_offsets);
+
+  EXPECT_TRUE(reference_segment.references_single_chunk());
+  EXPECT_EQ(reference_segment.size(), 2u);
+  EXPECT_EQ(reference_segment.row_id(0), (RowID{ChunkID{1}, 1}));
+  EXPECT_EQ(reference_segment[0], AllTypeVariant{12345});
+  EXPECT_EQ(reference_segment[1], AllTypeVariant{54321});
+  EXPECT_EQ(reference_segment.materialize_values<int>(), (pmr_vector<int>{12345, 54321}));
+}
+
 }  // namespace opossum
@@ -0,0 +1,48 @@
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/selection_bitmap.hpp"
+
+namespace opossum {
+
+class StorageSelectionBitmapTest : public BaseTest {
+ protected:
+  // selects the rows 0, 3, 64, 65 and 129 of a chunk with 130 rows
+  SelectionBitmap _bitmap{pmr_vector<uint64_t>{0b1001, 0b11, 0b10}, 130};
+};
+
+TEST_F(StorageSelectionBitmapTest, Size) {
+  EXPECT_EQ(_bitmap.size(), 5u);
+  EXPECT_EQ(_bitmap.chunk_size(), 130u);
+  EXPECT_EQ(SelectionBitmap::word_count(130), 3u);
+  EXPECT_EQ(SelectionBitmap::word_count(128), 2u);
+}
+
+TEST_F(StorageSelectionBitmapTest, Access) {
+  EXPECT_TRUE(_bitmap.is_selected(3));
+  EXPECT_FALSE(_bitmap.is_selected(4));
+  EXPECT_TRUE(_bitmap.is_selected(129));
+
+  EXPECT_EQ(_bitmap[0], 0u);
+  EXPECT_EQ(_bitmap[1], 3u);
+  EXPECT_EQ(_bitmap[2], 64u);
+  EXPECT_EQ(_bitmap[3], 65u);
+  EXPECT_EQ(_bitmap[4], 129u);
+}
+
+TEST_F(StorageSelectionBitmapTest, Iteration) {
+  auto chunk_offsets = std::vector<ChunkOffset>{};
+  _bitmap.for_each([&](const ChunkOffset chunk_offset) { chunk_offsets.push_back(chunk_offset); });
+  EXPECT_EQ(chunk_offsets, (std::vector<ChunkOffset>{0, 3, 64, 65, 129}));
+  EXPECT_EQ(_bitmap.to_chunk_offsets(), (ChunkOffsetList{0, 3, 64, 65, 129}));
+}
+
+TEST_F(StorageSelectionBitmapTest, SmallerThanChunkOffsets) {
+  // 16 words with their ranks need 192 bytes, as much as 48 chunk offsets
+  EXPECT_FALSE(SelectionBitmap::is_smaller_than_chunk_offsets(48, 1000));
+  EXPECT_TRUE(SelectionBitmap::is_smaller_than_chunk_offsets(49, 1000));
+}
+
+}  // namespace opossum
@@ -1,5 +1,13 @@
+#include <unistd.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
 #include <memory>
+#include <set>
+#include <sstream>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "../base_test.hpp"
@@ -75,4 +83,155 @@ TEST_F(StorageStorageManagerTest, Print) {
   EXPECT_EQ(expected_output, buffer.str());
 }
 
+TEST_F(StorageStorageManagerTest, EstimateMemoryUsage) {
+  auto& sm = StorageManager::get();
+  auto t3 = std::make_shared<Table>();
+  t3->add_column("a", "int");
+  t3->add_column("b", "string");
+  t3->append({1, "one"});
+  sm.add_table("third_table", t3);
+
+  const auto table_usage = sm.get_table("first_table")->estimate_memory_usage() +
+                           sm.get_table("second_table")->estimate_memory_usage() + t3->estimate_memory_usage();
+  EXPECT_EQ(sm.estimate_memory_usage(), table_usage);
+
+  std::ostringstream buffer;
+  sm.print_memory_usage(buffer);
+  const auto output = buffer.str();
+  EXPECT_NE(output.find("third_table " + std::to_string(t3->estimate_memory_usage()) + "\n"), std::string::npos);
+  EXPECT_NE(output.find("  a int " + std::to_string(t3->estimate_column_memory_usage(ColumnID{0})) + "\n"),
+            std::string::npos);
+  EXPECT_NE(output.find("  b string " + std::to_string(t3->estimate_column_memory_usage(ColumnID{1})) + "\n"),
+            std::string::npos);
+}
+
+TEST_F(StorageStorageManagerTest, CheckpointAndRestore) {
+  auto& sm = StorageManager::get();
+  auto t3 = std::make_shared<Table>(2);
+  t3->add_column("a", "int");
+  t3->add_column("b", "string");
+  t3->append({1, "one"});
+  t3->append({2, "two"});
+  t3->append({3, "three"});
+  t3->compress_chunk(ChunkID{0});
+  sm.add_table("third table", t3);
+
+  char directory_template[] = "/tmp/storage_manager_test_XXXXXX";
+  const auto directory = std::string{mkdtemp(directory_template)};
+  sm.checkpoint(directory);
+
+  std::ostringstream expected_output;
+  sm.print(expected_output);
+
+  StorageManager::reset();
+  EXPECT_FALSE(sm.has_table("third table"));
+  sm.restore(directory);
+
+  // the catalog is available before any table has been loaded
+  EXPECT_TRUE(sm.has_table("first_table"));
+  EXPECT_TRUE(sm.has_table("third table"));
+  EXPECT_EQ(sm.table_names().size(), 3u);
+  EXPECT_EQ(sm.estimate_memory_usage(), 0u);
+  std::ostringstream restored_output;
+  sm.print(restored_output);
+
+  // the order of the tables is not defined
+  const auto output_lines = [](const std::ostringstream& output) {
+    auto lines = std::multiset<std::string>{};
+    std::istringstream stream(output.str());
+    for (std::string line; std::getline(stream, line);) lines.insert(line);
+    return lines;
+  };
+  EXPECT_EQ(output_lines(restored_output), output_lines(expected_output));
+
+  // the data is loaded on first access
+  const auto restored_t3 = sm.get_table("third table");
+  EXPECT_TABLE_EQ(restored_t3, t3, true);
+  EXPECT_EQ(restored_t3->chunk_count(), 2u);
+  EXPECT_GT(sm.estimate_memory_usage(), 0u);
+  EXPECT_EQ(sm.get_table("third table"), restored_t3);
+
+  sm.drop_table("second_table");
+  EXPECT_FALSE(sm.has_table("second_table"));
+  EXPECT_THROW(sm.restore(directory), std::exception);
+
+  std::filesystem::remove_all(directory);
+}
+
+TEST_F(StorageStorageManagerTest, CheckpointRestoredTables) {
+  auto& sm = StorageManager::get();
+  auto t3 = std::make_shared<Table>(2);
+  t3->add_column("a", "int");
+  t3->append({3});
+  sm.add_table("third_table", t3);
+
+  char directory_template[] = "/tmp/storage_manager_test_XXXXXX";
+  const auto directory = std::string{mkdtemp(directory_template)};
+  sm.checkpoint(directory);
+
+  // only one of the restored tables is loaded before the tables are written to the same directory again
+  StorageManager::reset();
+  sm.restore(directory);
+  sm.get_table("second_table")->add_column("b", "string");
+  sm.checkpoint(directory);
+
+  StorageManager::reset();
+  sm.restore(directory);
+  EXPECT_EQ(sm.table_names().size(), 3u);
+  EXPECT_EQ(sm.get_table("first_table")->column_count(), 0u);
+  EXPECT_EQ(sm.get_table("second_table")->column_count(), 1u);
+  EXPECT_EQ(sm.get_table("second_table")->chunk_size(), 4u);
+  EXPECT_TABLE_EQ(sm.get_table("third_table"), t3);
+
+  // the files of the first checkpoint have been removed
+  auto entry_count = size_t{0};
+  for (const auto& entry : std::filesystem::directory_iterator(directory)) {
+    EXPECT_NE(entry.path().filename(), "data_0");
+    ++entry_count;
+  }
+  EXPECT_EQ(entry_count, 2u);
+
+  std::filesystem::remove_all(directory);
+}
+
+TEST_F(StorageStorageManagerTest, LoadRestoredTableConcurrently) {
+  auto& sm = StorageManager::get();
+  auto table = std::make_shared<Table>(2);
+  table->add_column("a", "int");
+  for (auto value = 0; value < 100; ++value) {
+    table->append({value});
+  }
+  sm.add_table("third_table", table);
+
+  char directory_template[] = "/tmp/storage_manager_test_XXXXXX";
+  const auto directory = std::string{mkdtemp(directory_template)};
+  sm.checkpoint(directory);
+  StorageManager::reset();
+  sm.restore(directory);
+
+  // all threads get the same table, which is loaded once, while the catalog remains readable
+  auto loaded_tables = std::vector<std::shared_ptr<Table>>(8);
+  auto threads = std::vector<std::thread>{};
+  for (auto thread_id = size_t{0}; thread_id < loaded_tables.size(); ++thread_id) {
+    threads.emplace_back([&, thread_id]() {
+      EXPECT_TRUE(sm.has_table("third_table"));
+      loaded_tables[thread_id] = sm.get_table("third_table");
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  for (const auto& loaded_table : loaded_tables) {
+    EXPECT_EQ(loaded_table, sm.get_table("third_table"));
+  }
+  EXPECT_TABLE_EQ(loaded_tables.front(), table, true);
+  EXPECT_EQ(sm.loaded_tables().size(), 1u);
+
+  std::filesystem::remove_all(directory);
+}
+
+TEST_F(StorageStorageManagerTest, RestoreMissingCheckpoint) {
+  EXPECT_THROW(StorageManager::get().restore("/tmp/does/not/exist"), std::exception);
+}
+
 }  // namespace opossum
@@ -1,5 +1,6 @@
 #include <limits>
 #include <memory>
+#include <set>
 #include <string>
 #include <utility>
 #include <vector>
@@ -8,6 +9,7 @@
 #include "gtest/gtest.h"
 
 #include "../lib/resolve_type.hpp"
+#include "../lib/storage/dictionary_segment.hpp"
 #include "../lib/storage/table.hpp"
 
 namespace opossum {
@@ -106,4 +108,153 @@ TEST_F(StorageTableTest, CompressChunk) {
   EXPECT_EQ(type_cast<int>((*segment)[1]), 6);
 }
 
+TEST_F(StorageTableTest, CompressChunkWithColumnDictionary) {
+  t.append({4, "Hello,", 1, 2, 3});
+  t.append({6, "world", 1, 2, 3});
+  t.append({6, "Hello,", 1, 2, 3});
+  t.append({4, "world", 1, 2, 3});
+  t.append({3, "!", 1, 2, 3});
+  t.append({4, "Hello,", 1, 2, 3});
+  for (ChunkID chunk_id{0}; chunk_id < t.chunk_count(); ++chunk_id) {
+    t.compress_chunk(chunk_id, DictionaryScope::Column);
+  }
+
+  const auto segment = [&](ChunkID chunk_id, ColumnID column_id) {
+    return std::dynamic_pointer_cast<const DictionarySegment<std::string>>(
+        t.get_chunk(chunk_id).get_segment(column_id));
+  };
+
+  // the second chunk has no new values and shares the dictionary of the first one
+  EXPECT_EQ(segment(ChunkID{0}, ColumnID{1})->dictionary(), segment(ChunkID{1}, ColumnID{1})->dictionary());
+  EXPECT_EQ(segment(ChunkID{0}, ColumnID{1})->attribute_vector()->get(0),
+            segment(ChunkID{1}, ColumnID{1})->attribute_vector()->get(0));
+
+  // the third chunk extends the dictionary, which remains sorted
+  const auto dictionary = segment(ChunkID{2}, ColumnID{1})->dictionary();
+  EXPECT_NE(dictionary, segment(ChunkID{0}, ColumnID{1})->dictionary());
+  EXPECT_EQ(*dictionary, (StringVector{"!", "Hello,", "world"}));
+  EXPECT_EQ(segment(ChunkID{2}, ColumnID{1})->get(0), "!");
+  EXPECT_EQ(segment(ChunkID{2}, ColumnID{1})->get(1), "Hello,");
+
+  t.unify_dictionary(ColumnID{1});
+  for (ChunkID chunk_id{0}; chunk_id < t.chunk_count(); ++chunk_id) {
+    EXPECT_EQ(segment(chunk_id, ColumnID{1})->dictionary(), dictionary);
+  }
+  EXPECT_EQ(segment(ChunkID{0}, ColumnID{1})->get(1), "world");
+  EXPECT_EQ(segment(ChunkID{0}, ColumnID{1})->attribute_vector()->get(0), ValueID{1});
+  EXPECT_EQ(segment(ChunkID{1}, ColumnID{1})->attribute_vector()->get(1), ValueID{2});
+}
+
+TEST_F(StorageTableTest, UnifyChunkDictionaries) {
+  t.append({4, "Hello,", 1, 2, 3});
+  t.append({6, "world", 1, 2, 3});
+  t.append({6, "Hello,", 1, 2, 3});
+  t.append({4, "world", 1, 2, 3});
+  t.append({3, "!", 1, 2, 3});
+  t.compress_chunk(ChunkID{0});
+  t.compress_chunk(ChunkID{2});
+
+  const auto segment = [&](ChunkID chunk_id) {
+    return std::dynamic_pointer_cast<const DictionarySegment<int>>(t.get_chunk(chunk_id).get_segment(ColumnID{0}));
+  };
+
+  // the uncompressed second chunk is skipped
+  t.unify_dictionary(ColumnID{0});
+  const auto dictionary = segment(ChunkID{0})->dictionary();
+  EXPECT_EQ(*dictionary, (pmr_vector<int>{3, 4, 6}));
+  EXPECT_EQ(segment(ChunkID{2})->dictionary(), dictionary);
+  EXPECT_EQ(segment(ChunkID{0})->get(0), 4);
+  EXPECT_EQ(segment(ChunkID{0})->get(1), 6);
+  EXPECT_EQ(segment(ChunkID{1}), nullptr);
+
+  // chunks that are compressed afterwards continue to use the unified dictionary
+  t.compress_chunk(ChunkID{1}, DictionaryScope::Column);
+  EXPECT_EQ(segment(ChunkID{1})->dictionary(), dictionary);
+}
+
+TEST_F(StorageTableTest, ColumnDictionaryVersionsAreLimited) {
+  // each chunk contains a new value, so that each one adds a version of the column's dictionary
+  const auto chunk_count = Table::MAX_COLUMN_DICTIONARY_VERSIONS * 2;
+  for (auto value = 0u; value < chunk_count * 2; ++value) {
+    t.append({static_cast<int>(value), "value", 1, 2, 3});
+  }
+  auto dictionaries = std::set<std::shared_ptr<const pmr_vector<int>>>{};
+  for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
+    t.compress_chunk(chunk_id, DictionaryScope::Column);
+    for (ChunkID compressed_chunk_id{0}; compressed_chunk_id <= chunk_id; ++compressed_chunk_id) {
+      dictionaries.insert(std::dynamic_pointer_cast<const DictionarySegment<int>>(
+                              t.get_chunk(compressed_chunk_id).get_segment(ColumnID{0}))
+                              ->dictionary());
+    }
+    EXPECT_LE(dictionaries.size(), Table::MAX_COLUMN_DICTIONARY_VERSIONS);
+    dictionaries.clear();
+  }
+
+  // the segments of all chunks that were unified last share the dictionary and can be decoded with it
+  const auto segment = [&](const ChunkID chunk_id) {
+    return std::dynamic_pointer_cast<const DictionarySegment<int>>(t.get_chunk(chunk_id).get_segment(ColumnID{0}));
+  };
+  EXPECT_EQ(segment(ChunkID{0})->dictionary(), segment(ChunkID{Table::MAX_COLUMN_DICTIONARY_VERSIONS})->dictionary());
+  for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
+    EXPECT_EQ(segment(chunk_id)->get(1), static_cast<int>(chunk_id * 2 + 1));
+  }
+}
+
+TEST_F(StorageTableTest, UnifyDictionaryChangesVersion) {
+  t.append({4, "Hello,", 1, 2, 3});
+  t.append({6, "world", 1, 2, 3});
+  t.append({3, "!", 1, 2, 3});
+  t.compress_chunk(ChunkID{0});
+  t.compress_chunk(ChunkID{1});
+
+  const auto version = t.version();
+  t.unify_dictionary(ColumnID{0});
+  EXPECT_GT(t.version(), version);
+}
+
+TEST_F(StorageTableTest, EstimateMemoryUsageOfSharedDictionaries) {
+  for (auto value = 0; value < 100; ++value) {
+    t.append({value % 10, "value_" + std::to_string(100 + value % 10), 1, 2, 3});
+  }
+  for (ChunkID chunk_id{0}; chunk_id < t.chunk_count(); ++chunk_id) {
+    t.compress_chunk(chunk_id, DictionaryScope::Column);
+  }
+  t.unify_dictionary(ColumnID{1});
+  const auto segment = [&](const ChunkID chunk_id) {
+    return std::dynamic_pointer_cast<const DictionarySegment<std::string>>(
+        t.get_chunk(chunk_id).get_segment(ColumnID{1}));
+  };
+  ASSERT_EQ(segment(ChunkID{0})->dictionary(), segment(ChunkID{49})->dictionary());
+
+  // the dictionary that all 50 chunks share is counted once for the column and the table
+  const auto& dictionary = *segment(ChunkID{49})->dictionary();
+  const auto dictionary_usage = sizeof(dictionary) + vector_heap_size(dictionary);
+  auto segment_usage = size_t{0};
+  auto chunk_usage = size_t{0};
+  for (ChunkID chunk_id{0}; chunk_id < t.chunk_count(); ++chunk_id) {
+    segment_usage += segment(chunk_id)->estimate_memory_usage();
+    chunk_usage += t.get_chunk(chunk_id).estimate_memory_usage();
+  }
+  EXPECT_EQ(t.estimate_column_memory_usage(ColumnID{1}),
+            segment_usage - (t.chunk_count() - 1) * dictionary_usage);
+  EXPECT_LT(t.estimate_memory_usage(), chunk_usage);
+}
+
+TEST_F(StorageTableTest, EstimateMemoryUsage) {
+  const auto empty_usage = t.estimate_memory_usage();
+  EXPECT_GT(empty_usage, 0u);
+
+  t.append({4, "Hello,", 1, 2, 3});
+  t.append({6, "world", 1, 2, 3});
+  t.append({3, "!", 1, 2, 3});
+  const auto usage = t.estimate_memory_usage();
+  EXPECT_GT(usage, empty_usage);
+
+  auto column_usage = size_t{0};
+  for (ColumnID column_id{0}; column_id < t.column_count(); ++column_id) {
+    column_usage += t.estimate_column_memory_usage(column_id);
+  }
+  EXPECT_LT(column_usage, usage);
+}
+
 }  // namespace opossum
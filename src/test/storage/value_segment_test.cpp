@@ -35,13 +35,13 @@ TEST_F(StorageValueSegmentTest, AddValueOfSameType) {
 
 TEST_F(StorageValueSegmentTest, Values) {
   int_value_segment.append(3);
-  EXPECT_EQ(int_value_segment.values(), std::vector<int>{3});
+  EXPECT_EQ(int_value_segment.values(), pmr_vector<int>{3});
 
   string_value_segment.append("Hello");
-  EXPECT_EQ(string_value_segment.values(), std::vector<std::string>{"Hello"});
+  EXPECT_EQ(string_value_segment.values(), StringVector{"Hello"});
 
   double_value_segment.append(3.14);
-  EXPECT_EQ(double_value_segment.values(), std::vector<double>{3.14});
+  EXPECT_EQ(double_value_segment.values(), pmr_vector<double>{3.14});
 }
 
 TEST_F(StorageValueSegmentTest, AddValueOfDifferentType) {
@@ -60,4 +60,18 @@ TEST_F(StorageValueSegmentTest, AddValueOfDifferentType) {
   EXPECT_THROW(double_value_segment.append("Hi"), std::exception);
 }
 
+TEST_F(StorageValueSegmentTest, EstimateMemoryUsage) {
+  const auto empty_usage = int_value_segment.estimate_memory_usage();
+  EXPECT_GE(empty_usage, sizeof(ValueSegment<int>));
+
+  for (auto value = 0; value < 100; ++value) int_value_segment.append(value);
+  EXPECT_GE(int_value_segment.estimate_memory_usage(), empty_usage + 100 * sizeof(int));
+
+  // short strings are stored within the string object, long strings are stored on the heap
+  string_value_segment.append("short");
+  const auto short_string_usage = string_value_segment.estimate_memory_usage();
+  string_value_segment.append(std::string(200, 'x'));
+  EXPECT_GE(string_value_segment.estimate_memory_usage(), short_string_usage + 200);
+}
+
 }  // namespace opossum
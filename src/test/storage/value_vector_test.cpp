@@ -0,0 +1,68 @@
+#include <algorithm>
+#include <memory_resource>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/value_vector.hpp"
+#include "../lib/utils/size_estimation_utils.hpp"
+
+namespace opossum {
+
+class StorageValueVectorTest : public BaseTest {
+ protected:
+  StringVector _strings{"", "Alexander", "Bill", "Hasso", "Steve with a name that does not fit into the SSO buffer"};
+};
+
+TEST_F(StorageValueVectorTest, Access) {
+  ASSERT_EQ(_strings.size(), 5u);
+  EXPECT_EQ(_strings[0], "");
+  EXPECT_EQ(_strings[2], "Bill");
+  EXPECT_EQ(_strings.at(3), "Hasso");
+  EXPECT_EQ(_strings.back(), "Steve with a name that does not fit into the SSO buffer");
+  EXPECT_THROW(_strings.at(5), std::exception);
+
+  _strings.push_back("Eva");
+  EXPECT_EQ(_strings.size(), 6u);
+  EXPECT_EQ(_strings.back(), "Eva");
+}
+
+TEST_F(StorageValueVectorTest, StoresCharactersContiguously) {
+  EXPECT_EQ(std::string(_strings.characters().cbegin(), _strings.characters().cend()),
+            "AlexanderBillHassoSteve with a name that does not fit into the SSO buffer");
+  EXPECT_EQ(_strings[1].data() + _strings[1].size(), _strings[2].data());
+}
+
+TEST_F(StorageValueVectorTest, Iterators) {
+  const auto values = std::vector<std::string_view>(_strings.cbegin(), _strings.cend());
+  EXPECT_EQ(values.size(), 5u);
+  EXPECT_EQ(values[1], "Alexander");
+
+  EXPECT_EQ(std::lower_bound(_strings.cbegin(), _strings.cend(), std::string{"Bill"}) - _strings.cbegin(), 2);
+  EXPECT_EQ(std::upper_bound(_strings.cbegin(), _strings.cend(), std::string{"Bill"}) - _strings.cbegin(), 3);
+  EXPECT_TRUE(std::is_sorted(_strings.cbegin(), _strings.cend()));
+}
+
+TEST_F(StorageValueVectorTest, UsesGivenAllocator) {
+  std::pmr::monotonic_buffer_resource memory_resource;
+  auto strings = StringVector{PolymorphicAllocator<char>{&memory_resource}};
+  strings.push_back("Hello");
+  EXPECT_EQ(strings.get_allocator().resource(), &memory_resource);
+  EXPECT_EQ(strings.characters().get_allocator().resource(), &memory_resource);
+}
+
+TEST_F(StorageValueVectorTest, SmallerThanVectorOfStrings) {
+  auto string_vector = StringVector{};
+  auto vector_of_strings = std::vector<std::string>{};
+  for (auto index = 0; index < 100; ++index) {
+    const auto value = "https://example.com/some/path/" + std::to_string(index);
+    string_vector.push_back(value);
+    vector_of_strings.push_back(value);
+  }
+  EXPECT_LT(vector_heap_size(string_vector), vector_heap_size(vector_of_strings));
+}
+
+}  // namespace opossum
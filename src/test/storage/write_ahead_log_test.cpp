@@ -0,0 +1,209 @@
+#include <unistd.h>
+
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/storage_manager.hpp"
+#include "../lib/storage/table.hpp"
+#include "../lib/storage/write_ahead_log.hpp"
+
+namespace opossum {
+
+class StorageWriteAheadLogTest : public BaseTest {
+ protected:
+  void SetUp() override { std::remove(_file_name.c_str()); }
+
+  void TearDown() override { std::remove(_file_name.c_str()); }
+
+  // creates an empty table and registers it in the StorageManager
+  std::shared_ptr<Table> _create_table(const std::string& name) {
+    auto table = std::make_shared<Table>(3);
+    table->add_column("a", "int");
+    table->add_column("b", "string");
+    table->add_column("c", "double");
+    StorageManager::get().add_table(name, table);
+    return table;
+  }
+
+  // simulates a restart by creating empty tables and replaying the log into them
+  void _restart() {
+    StorageManager::reset();
+    _create_table("first");
+    _create_table("second");
+  }
+
+  const std::string _file_name = "write_ahead_log_test.log";
+};
+
+TEST_F(StorageWriteAheadLogTest, ReplayAppendedRows) {
+  auto first = _create_table("first");
+  auto second = _create_table("second");
+  {
+    auto write_ahead_log = std::make_shared<WriteAheadLog>(_file_name);
+    first->set_write_ahead_log(write_ahead_log, "first");
+    second->set_write_ahead_log(write_ahead_log, "second");
+    for (auto value = 0; value < 10; ++value) {
+      first->append({value, "value " + std::to_string(value), value * 0.5});
+      second->append({-value, "", 1.0});
+    }
+    write_ahead_log->flush();
+    first->set_write_ahead_log(nullptr, "first");
+    second->set_write_ahead_log(nullptr, "second");
+  }
+
+  _restart();
+  EXPECT_EQ(WriteAheadLog::replay(_file_name), 20u);
+  EXPECT_TABLE_EQ(StorageManager::get().get_table("first"), first, true);
+  EXPECT_TABLE_EQ(StorageManager::get().get_table("second"), second, true);
+}
+
+TEST_F(StorageWriteAheadLogTest, RowsAreWrittenOnDestruction) {
+  auto first = _create_table("first");
+  {
+    // neither the group size nor the interval is reached before the log is destroyed
+    auto write_ahead_log = std::make_shared<WriteAheadLog>(_file_name, 1000, std::chrono::seconds{60});
+    first->set_write_ahead_log(write_ahead_log, "first");
+    first->append({1, "one", 1.0});
+    first->set_write_ahead_log(nullptr, "first");
+  }
+
+  _restart();
+  EXPECT_EQ(WriteAheadLog::replay(_file_name), 1u);
+  EXPECT_TABLE_EQ(StorageManager::get().get_table("first"), first, true);
+}
+
+TEST_F(StorageWriteAheadLogTest, SynchronousCommitFromMultipleThreads) {
+  auto first = _create_table("first");
+  auto second = _create_table("second");
+  {
+    auto write_ahead_log = std::make_shared<WriteAheadLog>(_file_name, 8, std::chrono::seconds{60}, true);
+
+    // the tables are not thread-safe for appends, so every thread appends to its own table
+    auto threads = std::vector<std::thread>{};
+    for (const auto& table_pair : {std::make_pair(first, "first"), std::make_pair(second, "second")}) {
+      table_pair.first->set_write_ahead_log(write_ahead_log, table_pair.second);
+      threads.emplace_back([table = table_pair.first]() {
+        for (auto value = 0; value < 50; ++value) {
+          table->append({value, "x", 0.0});
+        }
+      });
+    }
+    for (auto& thread : threads) thread.join();
+
+    // all rows are durable without flushing, because every append waited for its group
+    _restart();
+    EXPECT_EQ(WriteAheadLog::replay(_file_name), 100u);
+  }
+
+  EXPECT_TABLE_EQ(StorageManager::get().get_table("first"), first, true);
+  EXPECT_TABLE_EQ(StorageManager::get().get_table("second"), second, true);
+}
+
+TEST_F(StorageWriteAheadLogTest, PartiallyWrittenGroup) {
+  auto first = _create_table("first");
+  {
+    auto write_ahead_log = std::make_shared<WriteAheadLog>(_file_name);
+    first->set_write_ahead_log(write_ahead_log, "first");
+    first->append({1, "one", 1.0});
+    write_ahead_log->flush();
+    first->set_write_ahead_log(nullptr, "first");
+  }
+
+  // simulate a crash while a group was written
+  {
+    std::ofstream file(_file_name, std::ios::binary | std::ios::app);
+    file << "garbage";
+  }
+
+  _restart();
+  EXPECT_EQ(WriteAheadLog::replay(_file_name), 1u);
+
+  // opening the log cuts off the partial group so that new groups can be replayed
+  {
+    auto write_ahead_log = std::make_shared<WriteAheadLog>(_file_name);
+    const auto restored_first = StorageManager::get().get_table("first");
+    restored_first->set_write_ahead_log(write_ahead_log, "first");
+    restored_first->append({2, "two", 2.0});
+    restored_first->set_write_ahead_log(nullptr, "first");
+  }
+
+  _restart();
+  EXPECT_EQ(WriteAheadLog::replay(_file_name), 2u);
+  EXPECT_EQ(StorageManager::get().get_table("first")->row_count(), 2u);
+}
+
+TEST_F(StorageWriteAheadLogTest, ReplayAfterCheckpoint) {
+  char directory_template[] = "/tmp/write_ahead_log_test_XXXXXX";
+  const auto directory = std::string{mkdtemp(directory_template)};
+
+  auto first = _create_table("first");
+  {
+    auto write_ahead_log = std::make_shared<WriteAheadLog>(_file_name);
+    first->set_write_ahead_log(write_ahead_log, "first");
+    for (auto value = 0; value < 5; ++value) {
+      first->append({value, "before", 0.0});
+    }
+    StorageManager::get().checkpoint(directory);
+    for (auto value = 5; value < 8; ++value) {
+      first->append({value, "after", 0.0});
+    }
+    first->set_write_ahead_log(nullptr, "first");
+  }
+
+  // the rows of the checkpoint are not replayed a second time
+  StorageManager::reset();
+  StorageManager::get().restore(directory);
+  EXPECT_EQ(WriteAheadLog::replay(_file_name), 3u);
+  EXPECT_TABLE_EQ(StorageManager::get().get_table("first"), first, true);
+
+  // replaying the log again does not change the table
+  EXPECT_EQ(WriteAheadLog::replay(_file_name), 0u);
+  EXPECT_EQ(StorageManager::get().get_table("first")->row_count(), 8u);
+
+  std::filesystem::remove_all(directory);
+}
+
+TEST_F(StorageWriteAheadLogTest, RejectedRowsAreNotInserted) {
+  auto first = _create_table("first");
+  {
+    auto write_ahead_log = std::make_shared<WriteAheadLog>(_file_name);
+    first->set_write_ahead_log(write_ahead_log, "first");
+    first->append({1, "one", 1.0});
+    // the third value cannot be converted, so that neither the log nor the table contain the row
+    EXPECT_THROW(first->append({2, "two", "not a number"}), std::exception);
+    EXPECT_EQ(first->row_count(), 1u);
+    first->append({3, "three", 3.0});
+    write_ahead_log->flush();
+    first->set_write_ahead_log(nullptr, "first");
+  }
+
+  _restart();
+  EXPECT_EQ(WriteAheadLog::replay(_file_name), 2u);
+  EXPECT_TABLE_EQ(StorageManager::get().get_table("first"), first, true);
+}
+
+TEST_F(StorageWriteAheadLogTest, ReplayWithoutLog) { EXPECT_EQ(WriteAheadLog::replay(_file_name), 0u); }
+
+TEST_F(StorageWriteAheadLogTest, ReplayIntoUnknownTable) {
+  auto first = _create_table("first");
+  {
+    auto write_ahead_log = std::make_shared<WriteAheadLog>(_file_name);
+    first->set_write_ahead_log(write_ahead_log, "first");
+    first->append({1, "one", 1.0});
+    first->set_write_ahead_log(nullptr, "first");
+  }
+
+  StorageManager::reset();
+  EXPECT_THROW(WriteAheadLog::replay(_file_name), std::exception);
+}
+
+}  // namespace opossum
@@ -0,0 +1,60 @@
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/utils/hardware_counters.hpp"
+
+namespace opossum {
+
+class HardwareCountersTest : public BaseTest {
+ protected:
+  void TearDown() override { HardwareCounters::set_enabled(false); }
+};
+
+TEST_F(HardwareCountersTest, NotAvailableIfDisabled) {
+  HardwareCounters::set_enabled(false);
+  EXPECT_FALSE(HardwareCounters::is_enabled());
+  EXPECT_FALSE(HardwareCounters::read().available);
+}
+
+TEST_F(HardwareCountersTest, CountIfPermitted) {
+  HardwareCounters::set_enabled(true);
+  EXPECT_TRUE(HardwareCounters::is_enabled());
+
+  // the counters cannot be opened on every system, in which case they are only reported as not available
+  const auto before = HardwareCounters::read();
+  auto sum = uint64_t{0};
+  for (auto index = uint64_t{0}; index < 100'000; ++index) {
+    sum += index * index;
+  }
+  EXPECT_GT(sum, 0u);
+  const auto difference = HardwareCounters::read() - before;
+
+  EXPECT_EQ(difference.available, before.available);
+  if (difference.available) {
+    EXPECT_GT(difference.instructions, 0u);
+  }
+}
+
+TEST_F(HardwareCountersTest, Arithmetic) {
+  const auto first = HardwareCounterValues{true, 10, 20, 3, 4};
+  const auto second = HardwareCounterValues{true, 15, 30, 5, 4};
+
+  const auto difference = second - first;
+  EXPECT_TRUE(difference.available);
+  EXPECT_EQ(difference.cycles, 5u);
+  EXPECT_EQ(difference.instructions, 10u);
+  EXPECT_EQ(difference.llc_misses, 2u);
+  EXPECT_EQ(difference.branch_misses, 0u);
+  EXPECT_FALSE((second - HardwareCounterValues{}).available);
+
+  auto sum = HardwareCounterValues{};
+  sum += HardwareCounterValues{};
+  EXPECT_FALSE(sum.available);
+  sum += first;
+  sum += second;
+  EXPECT_TRUE(sum.available);
+  EXPECT_EQ(sum.cycles, 25u);
+  EXPECT_EQ(sum.branch_misses, 8u);
+}
+
+}  // namespace opossum
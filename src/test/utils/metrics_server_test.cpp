@@ -0,0 +1,65 @@
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <array>
+#include <string>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/utils/metrics.hpp"
+#include "../lib/utils/metrics_server.hpp"
+
+namespace opossum {
+
+class MetricsServerTest : public BaseTest {
+ protected:
+  // sends the request to the server on the loopback interface and returns the complete response
+  static std::string fetch(const uint16_t port, const std::string& request) {
+    const auto client = socket(AF_INET, SOCK_STREAM, 0);
+    auto address = sockaddr_in{};
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    address.sin_port = htons(port);
+    if (connect(client, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0) {
+      close(client);
+      return "";
+    }
+    send(client, request.data(), request.size(), 0);
+
+    auto response = std::string{};
+    auto buffer = std::array<char, 1024>{};
+    for (auto received_bytes = recv(client, buffer.data(), buffer.size(), 0); received_bytes > 0;
+         received_bytes = recv(client, buffer.data(), buffer.size(), 0)) {
+      response.append(buffer.data(), static_cast<size_t>(received_bytes));
+    }
+    close(client);
+    return response;
+  }
+};
+
+TEST_F(MetricsServerTest, ServesMetricsOnLoopback) {
+  MetricsRegistry::get().counter("test_server_requests_total", "Requests").increment(7);
+
+  const auto server = MetricsServer{};
+  EXPECT_GT(server.port(), 0);
+
+  const auto response = fetch(server.port(), "GET /metrics HTTP/1.1\r\nHost: localhost\r\n\r\n");
+  EXPECT_EQ(response.find("HTTP/1.1 200 OK\r\n"), 0u);
+  EXPECT_NE(response.find("Content-Type: text/plain; version=0.0.4\r\n"), std::string::npos);
+  EXPECT_NE(response.find("\ntest_server_requests_total 7\n"), std::string::npos);
+
+  // the server handles further connections
+  EXPECT_EQ(fetch(server.port(), "GET /other HTTP/1.1\r\n\r\n").find("HTTP/1.1 404 Not Found\r\n"), 0u);
+}
+
+TEST_F(MetricsServerTest, HandleRequest) {
+  EXPECT_EQ(MetricsServer::handle_request("GET /metrics HTTP/1.0\r\n\r\n").find("HTTP/1.1 200 OK"), 0u);
+  EXPECT_EQ(MetricsServer::handle_request("POST /metrics HTTP/1.1\r\n\r\n").find("HTTP/1.1 405"), 0u);
+  EXPECT_EQ(MetricsServer::handle_request("GET /favicon.ico HTTP/1.1\r\n\r\n").find("HTTP/1.1 404"), 0u);
+  EXPECT_EQ(MetricsServer::handle_request("garbage").find("HTTP/1.1 400"), 0u);
+}
+
+}  // namespace opossum
@@ -0,0 +1,96 @@
+#include <memory>
+#include <string>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/operators/table_scan.hpp"
+#include "../lib/operators/table_wrapper.hpp"
+#include "../lib/storage/storage_manager.hpp"
+#include "../lib/storage/table.hpp"
+#include "../lib/utils/metrics.hpp"
+
+namespace opossum {
+
+class MetricsTest : public BaseTest {
+ protected:
+  void SetUp() override { MetricsRegistry::get().reset(); }
+  void TearDown() override { StorageManager::reset(); }
+
+  static bool contains(const std::string& text, const std::string& line) {
+    return text.find(line + "\n") != std::string::npos;
+  }
+};
+
+TEST_F(MetricsTest, CountersAndGauges) {
+  auto& registry = MetricsRegistry::get();
+  auto& counter = registry.counter("test_requests_total", "Number of requests", {{"path", "/a"}});
+  counter.increment();
+  counter.increment(2);
+  EXPECT_EQ(&registry.counter("test_requests_total", "Number of requests", {{"path", "/a"}}), &counter);
+  registry.counter("test_requests_total", "Number of requests", {{"path", "/b\"c"}}).increment();
+
+  auto& gauge = registry.gauge("test_temperature", "Temperature");
+  gauge.set(20.5);
+  gauge.add(-0.5);
+  EXPECT_EQ(gauge.value(), 20.0);
+
+  const auto text = registry.prometheus_text();
+  EXPECT_TRUE(contains(text, "# HELP test_requests_total Number of requests"));
+  EXPECT_TRUE(contains(text, "# TYPE test_requests_total counter"));
+  EXPECT_TRUE(contains(text, "test_requests_total{path=\"/a\"} 3"));
+  EXPECT_TRUE(contains(text, "test_requests_total{path=\"/b\\\"c\"} 1"));
+  EXPECT_TRUE(contains(text, "# TYPE test_temperature gauge"));
+  EXPECT_TRUE(contains(text, "test_temperature 20"));
+
+  EXPECT_THROW(registry.gauge("test_requests_total", "Number of requests"), std::exception);
+
+  registry.reset();
+  EXPECT_EQ(counter.value(), 0u);
+}
+
+TEST_F(MetricsTest, Histograms) {
+  auto& histogram = MetricsRegistry::get().histogram("test_duration_seconds", "Duration", {}, {0.1, 1.0});
+  histogram.observe(0.05);
+  histogram.observe(0.1);
+  histogram.observe(0.5);
+  histogram.observe(2.0);
+  EXPECT_EQ(histogram.cumulative_bucket_counts(), (std::vector<uint64_t>{2, 3, 4}));
+  EXPECT_EQ(histogram.count(), 4u);
+  EXPECT_DOUBLE_EQ(histogram.sum(), 2.65);
+
+  const auto text = MetricsRegistry::get().prometheus_text();
+  EXPECT_TRUE(contains(text, "# TYPE test_duration_seconds histogram"));
+  EXPECT_TRUE(contains(text, "test_duration_seconds_bucket{le=\"0.10000000000000001\"} 2"));
+  EXPECT_TRUE(contains(text, "test_duration_seconds_bucket{le=\"1\"} 3"));
+  EXPECT_TRUE(contains(text, "test_duration_seconds_bucket{le=\"+Inf\"} 4"));
+  EXPECT_TRUE(contains(text, "test_duration_seconds_count 4"));
+}
+
+TEST_F(MetricsTest, EngineMetrics) {
+  auto table = std::make_shared<Table>(10);
+  table->add_column("a", "int");
+  for (auto value = 0; value < 25; ++value) {
+    table->append({value});
+  }
+  table->compress_chunk(ChunkID{0});
+  StorageManager::get().add_table("table_a", table);
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+  // the dictionary of the first chunk shows that it has no matches
+  auto table_scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpGreaterThan, 12);
+  table_scan->execute();
+
+  const auto text = MetricsRegistry::get().prometheus_text();
+  EXPECT_TRUE(contains(text, "opossum_table_scan_rows_scanned_total 15"));
+  EXPECT_TRUE(contains(text, "opossum_chunks_pruned_total 1"));
+  EXPECT_TRUE(contains(text, "opossum_operator_duration_seconds_count{operator=\"TableScan\"} 1"));
+  EXPECT_TRUE(contains(text, "opossum_table_rows{table=\"table_a\"} 25"));
+  EXPECT_TRUE(contains(text, "opossum_table_chunks{table=\"table_a\"} 3"));
+  // the second chunk is full, but not compressed
+  EXPECT_TRUE(contains(text, "opossum_compression_backlog_chunks{table=\"table_a\"} 1"));
+  EXPECT_NE(text.find("opossum_table_memory_bytes{table=\"table_a\"} "), std::string::npos);
+}
+
+}  // namespace opossum
@@ -0,0 +1,87 @@
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/value_segment.hpp"
+#include "../lib/utils/performance_warning.hpp"
+
+namespace opossum {
+
+class PerformanceWarningTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    PerformanceWarningRegistry::reset();
+    _segment.append(1);
+    _segment.append(2);
+  }
+
+  void TearDown() override { PerformanceWarningRegistry::set_stack_sampling_interval(0); }
+
+  ValueSegment<int> _segment;
+};
+
+TEST_F(PerformanceWarningTest, CountsOccurrencesPerCallSite) {
+  EXPECT_EQ(PerformanceWarningRegistry::count("operator[] used"), 0u);
+  _segment[0];
+  _segment[1];
+  _segment[0];
+  EXPECT_EQ(PerformanceWarningRegistry::count("operator[] used"), 3u);
+
+  auto site_found = false;
+  for (const auto& site : PerformanceWarningRegistry::statistics()) {
+    if (site.file_name.find("value_segment.cpp") == std::string::npos) continue;
+    site_found = true;
+    EXPECT_EQ(site.text, "operator[] used");
+    EXPECT_EQ(site.count, 3u);
+    EXPECT_TRUE(site.stack_samples.empty());
+  }
+  EXPECT_TRUE(site_found);
+
+  PerformanceWarningRegistry::reset();
+  EXPECT_EQ(PerformanceWarningRegistry::count("operator[] used"), 0u);
+}
+
+TEST_F(PerformanceWarningTest, CountsOccurrencesOfAllThreads) {
+  auto threads = std::vector<std::thread>{};
+  for (auto thread_index = 0; thread_index < 20; ++thread_index) {
+    threads.emplace_back([&]() {
+      for (auto index = 0; index < 100; ++index) _segment[0];
+    });
+  }
+  for (auto& thread : threads) thread.join();
+  EXPECT_EQ(PerformanceWarningRegistry::count("operator[] used"), 2000u);
+}
+
+TEST_F(PerformanceWarningTest, DisablerExcludesIntendedUses) {
+  {
+    PerformanceWarningDisabler performance_warning_disabler;
+    _segment[0];
+  }
+  EXPECT_EQ(PerformanceWarningRegistry::count("operator[] used"), 0u);
+  _segment[0];
+  EXPECT_EQ(PerformanceWarningRegistry::count("operator[] used"), 1u);
+}
+
+TEST_F(PerformanceWarningTest, SamplesStackTraces) {
+  PerformanceWarningRegistry::set_stack_sampling_interval(2);
+  for (auto index = 0; index < 4 * static_cast<int>(PerformanceWarningRegistry::MAX_STACK_SAMPLES); ++index) {
+    _segment[0];
+  }
+
+  for (const auto& site : PerformanceWarningRegistry::statistics()) {
+    if (site.file_name.find("value_segment.cpp") == std::string::npos) continue;
+    EXPECT_EQ(site.stack_samples.size(), PerformanceWarningRegistry::MAX_STACK_SAMPLES);
+    EXPECT_FALSE(site.stack_samples.front().empty());
+  }
+
+  auto stream = std::ostringstream{};
+  PerformanceWarningRegistry::write_json(stream);
+  EXPECT_NE(stream.str().find("\"text\": \"operator[] used\""), std::string::npos);
+  EXPECT_NE(stream.str().find("\"count\": 32"), std::string::npos);
+}
+
+}  // namespace opossum
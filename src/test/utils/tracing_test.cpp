@@ -0,0 +1,111 @@
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/operators/pipeline.hpp"
+#include "../lib/operators/table_scan.hpp"
+#include "../lib/operators/table_wrapper.hpp"
+#include "../lib/scheduler/topology.hpp"
+#include "../lib/storage/table.hpp"
+#include "../lib/utils/tracing.hpp"
+
+namespace opossum {
+
+class TracingTest : public BaseTest {
+ protected:
+  void SetUp() override { Tracer::clear(); }
+
+  void TearDown() override {
+    Tracer::set_enabled(false);
+    Tracer::set_buffer_capacity(Tracer::DEFAULT_BUFFER_CAPACITY);
+    Tracer::clear();
+    Topology::reset();
+  }
+
+  static std::string trace() {
+    auto stream = std::ostringstream{};
+    Tracer::write_chrome_trace(stream);
+    return stream.str();
+  }
+};
+
+TEST_F(TracingTest, DisabledByDefault) {
+  EXPECT_FALSE(Tracer::is_enabled());
+  {
+    TraceSpan span{"test"};
+    EXPECT_FALSE(span.is_active());
+  }
+  EXPECT_EQ(Tracer::event_count(), 0u);
+}
+
+TEST_F(TracingTest, RecordsEventsOfAllThreads) {
+  Tracer::set_enabled(true);
+  {
+    TraceSpan span{"test"};
+    span.set_name("outer span", "some detail");
+    Tracer::record_instant("test", "instant \"event\"");
+  }
+  auto thread = std::thread{[]() {
+    Tracer::set_thread_name("other thread");
+    Tracer::record_instant("test", "event of other thread");
+  }};
+  thread.join();
+  EXPECT_EQ(Tracer::event_count(), 3u);
+
+  const auto json = trace();
+  EXPECT_NE(json.find("\"name\":\"outer span\",\"cat\":\"test\",\"ph\":\"X\""), std::string::npos);
+  EXPECT_NE(json.find("\"args\":{\"detail\":\"some detail\"}"), std::string::npos);
+  EXPECT_NE(json.find("\"name\":\"instant \\\"event\\\"\",\"cat\":\"test\",\"ph\":\"i\""), std::string::npos);
+  // the events of threads that have exited are kept
+  EXPECT_NE(json.find("\"args\":{\"name\":\"other thread\"}"), std::string::npos);
+  EXPECT_NE(json.find("event of other thread"), std::string::npos);
+
+  Tracer::clear();
+  EXPECT_EQ(Tracer::event_count(), 0u);
+}
+
+TEST_F(TracingTest, RingBufferKeepsNewestEvents) {
+  Tracer::set_enabled(true);
+  Tracer::set_buffer_capacity(2);
+  Tracer::clear();
+
+  Tracer::record_instant("test", "first");
+  Tracer::record_instant("test", "second");
+  Tracer::record_instant("test", "third");
+  EXPECT_EQ(Tracer::event_count(), 2u);
+
+  const auto json = trace();
+  EXPECT_EQ(json.find("first"), std::string::npos);
+  ASSERT_NE(json.find("second"), std::string::npos);
+  EXPECT_LT(json.find("second"), json.find("third"));
+}
+
+#if HYRISE_TRACING
+TEST_F(TracingTest, SpansOfOperatorsAndJobs) {
+  auto table = std::make_shared<Table>(10);
+  table->add_column("a", "int");
+  for (auto value = 0; value < 30; ++value) {
+    table->append({value});
+  }
+
+  Tracer::set_enabled(true);
+  table->compress_chunk(ChunkID{0});
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+  auto pipeline = Pipeline::create(std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpLessThan, 15));
+  pipeline->execute();
+
+  const auto json = trace();
+  EXPECT_NE(json.find("\"name\":\"compress chunk\",\"cat\":\"compression\""), std::string::npos);
+  EXPECT_NE(json.find("\"name\":\"TableWrapper\",\"cat\":\"operator\""), std::string::npos);
+  EXPECT_NE(json.find("\"name\":\"Pipeline [TableScan a < 15]\",\"cat\":\"operator\""), std::string::npos);
+  EXPECT_NE(json.find("\"name\":\"chunk 2\",\"cat\":\"job\""), std::string::npos);
+  EXPECT_NE(json.find("\"args\":{\"name\":\"worker 0 (node 0)\"}"), std::string::npos);
+}
+#endif
+
+}  // namespace opossum